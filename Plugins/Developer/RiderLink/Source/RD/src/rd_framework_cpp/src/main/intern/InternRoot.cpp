@@ -45,9 +45,7 @@ void InternRoot::bind(Lifetime lf, IRdDynamic const* parent, string_view name) c
 	{
 		// if something's interned before bind
 		std::lock_guard<decltype(lock)> guard(lock);
-		my_items_lis.clear();
-		other_items_list.clear();
-		inverse_map.clear();
+		table.clear();
 	}
 	get_protocol()->get_wire()->advise(lf, this);
 }
@@ -62,10 +60,10 @@ void InternRoot::identify(const Identities& /*identities*/, RdId const& id) cons
 
 void InternRoot::set_interned_correspondence(int32_t id, InternedAny&& value) const
 {
-	RD_ASSERT_MSG(!is_index_owned(id), "Setting interned correspondence for object that we should have written, bug?")
+	RD_ASSERT_MSG(!InternTable::is_index_owned(id), "Setting interned correspondence for object that we should have written, bug?")
 
+	const size_t hash = InternTable::hash_of(value);
 	std::lock_guard<decltype(lock)> guard(lock);
-	other_items_list[id / 2] = value;
-	inverse_map[value] = id;
+	table.add_other(id, std::move(value), hash);
 }
 }	 // namespace rd
@@ -0,0 +1,245 @@
+#include "InternTable.h"
+
+namespace rd
+{
+namespace
+{
+struct CachedId
+{
+	uint64_t generation = 0;
+	InternTable::Entry const* entry = nullptr;
+};
+
+constexpr size_t THREAD_CACHE_SIZE = 64;
+
+// Recently found entries of any table, direct-mapped by value hash
+thread_local CachedId thread_cache[THREAD_CACHE_SIZE];
+
+std::atomic<uint64_t> next_generation{1};
+}	 // namespace
+
+// region SlotArray
+
+InternTable::SlotArray::SlotArray()
+{
+	for (auto& segment : segments)
+	{
+		segment.store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+InternTable::SlotArray::~SlotArray()
+{
+	clear();
+}
+
+void InternTable::SlotArray::locate(size_t index, size_t& segment, size_t& offset)
+{
+	const size_t shifted = index + (size_t(1) << FIRST_SEGMENT_BITS);
+	size_t top_bit = 0;
+	for (size_t rest = shifted >> 1; rest != 0; rest >>= 1)
+	{
+		++top_bit;
+	}
+	segment = top_bit - FIRST_SEGMENT_BITS;
+	offset = shifted - (size_t(1) << top_bit);
+}
+
+InternTable::Entry const* InternTable::SlotArray::get(size_t index) const
+{
+	size_t segment = 0, offset = 0;
+	locate(index, segment, offset);
+	if (segment >= SEGMENT_COUNT)
+	{
+		return nullptr;
+	}
+	std::atomic<Entry const*> const* slots = segments[segment].load(std::memory_order_acquire);
+	return slots == nullptr ? nullptr : slots[offset].load(std::memory_order_acquire);
+}
+
+void InternTable::SlotArray::set(size_t index, Entry const* entry)
+{
+	size_t segment = 0, offset = 0;
+	locate(index, segment, offset);
+	RD_ASSERT_THROW_MSG(segment < SEGMENT_COUNT, "Interned id is out of range: " + std::to_string(index));
+
+	std::atomic<Entry const*>* slots = segments[segment].load(std::memory_order_relaxed);
+	if (slots == nullptr)
+	{
+		const size_t size = size_t(1) << (segment + FIRST_SEGMENT_BITS);
+		slots = new std::atomic<Entry const*>[size];
+		for (size_t i = 0; i < size; ++i)
+		{
+			slots[i].store(nullptr, std::memory_order_relaxed);
+		}
+		segments[segment].store(slots, std::memory_order_release);
+	}
+	slots[offset].store(entry, std::memory_order_release);
+}
+
+void InternTable::SlotArray::clear()
+{
+	for (auto& segment : segments)
+	{
+		delete[] segment.exchange(nullptr);
+	}
+}
+
+// endregion
+
+InternTable::Buckets::Buckets(size_t capacity) : mask(capacity - 1), slots(new std::atomic<Entry const*>[capacity])
+{
+	for (size_t i = 0; i < capacity; ++i)
+	{
+		slots[i].store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+InternTable::InternTable() : generation(next_generation++)
+{
+}
+
+InternTable::~InternTable() = default;
+
+size_t InternTable::hash_of(InternedAny const& value)
+{
+	return any::TransparentHash()(value);
+}
+
+InternTable::Entry const* InternTable::find_in_buckets(InternedAny const& value, size_t hash) const
+{
+	Buckets const* current = buckets.load(std::memory_order_acquire);
+	if (current == nullptr)
+	{
+		return nullptr;
+	}
+	// load factor is kept under 1/2, so probing always meets an empty slot
+	for (size_t i = hash & current->mask;; i = (i + 1) & current->mask)
+	{
+		Entry const* entry = current->slots[i].load(std::memory_order_acquire);
+		if (entry == nullptr)
+		{
+			return nullptr;
+		}
+		if (entry->hash == hash && entry->value == value)
+		{
+			return entry;
+		}
+	}
+}
+
+void InternTable::insert_in_buckets(Entry const* entry, bool overwrite)
+{
+	Buckets* current = buckets.load(std::memory_order_relaxed);
+	if (current == nullptr || (bucket_count + 1) * 2 > current->mask + 1)
+	{
+		grow();
+		current = buckets.load(std::memory_order_relaxed);
+	}
+	for (size_t i = entry->hash & current->mask;; i = (i + 1) & current->mask)
+	{
+		Entry const* existing = current->slots[i].load(std::memory_order_relaxed);
+		if (existing == nullptr)
+		{
+			current->slots[i].store(entry, std::memory_order_release);
+			++bucket_count;
+			return;
+		}
+		if (existing->hash == entry->hash && existing->value == entry->value)
+		{
+			if (overwrite)
+			{
+				current->slots[i].store(entry, std::memory_order_release);
+			}
+			return;
+		}
+	}
+}
+
+void InternTable::grow()
+{
+	Buckets const* old = buckets.load(std::memory_order_relaxed);
+	const size_t capacity = old == nullptr ? INITIAL_BUCKETS : (old->mask + 1) * 2;
+
+	auto grown = std::make_unique<Buckets>(capacity);
+	if (old != nullptr)
+	{
+		for (size_t i = 0; i <= old->mask; ++i)
+		{
+			Entry const* entry = old->slots[i].load(std::memory_order_relaxed);
+			if (entry == nullptr)
+			{
+				continue;
+			}
+			size_t j = entry->hash & grown->mask;
+			while (grown->slots[j].load(std::memory_order_relaxed) != nullptr)
+			{
+				j = (j + 1) & grown->mask;
+			}
+			grown->slots[j].store(entry, std::memory_order_relaxed);
+		}
+	}
+	// readers may still walk the old buckets, they stay alive until clear()
+	buckets.store(grown.get(), std::memory_order_release);
+	all_buckets.push_back(std::move(grown));
+}
+
+int32_t InternTable::find(InternedAny const& value, size_t hash) const
+{
+	const uint64_t current_generation = generation.load(std::memory_order_acquire);
+	CachedId& cached = thread_cache[hash & (THREAD_CACHE_SIZE - 1)];
+	if (cached.generation == current_generation && cached.entry->hash == hash && cached.entry->value == value)
+	{
+		return cached.entry->id;
+	}
+
+	Entry const* entry = find_in_buckets(value, hash);
+	if (entry == nullptr)
+	{
+		return -1;
+	}
+	cached.generation = current_generation;
+	cached.entry = entry;
+	return entry->id;
+}
+
+InternedAny const* InternTable::get(int32_t id) const
+{
+	Entry const* entry = is_index_owned(id) ? own_items.get(id / 2) : other_items.get(id / 2);
+	return entry == nullptr ? nullptr : &entry->value;
+}
+
+int32_t InternTable::add_own(InternedAny value, size_t hash)
+{
+	const int32_t id = own_count * 2;
+	entries.push_back(std::make_unique<Entry>(Entry{hash, id, std::move(value)}));
+	Entry const* entry = entries.back().get();
+
+	// publish by id first: whoever finds the id by value must be able to resolve it
+	own_items.set(id / 2, entry);
+	++own_count;
+	insert_in_buckets(entry, false);
+	return id;
+}
+
+void InternTable::add_other(int32_t id, InternedAny value, size_t hash)
+{
+	entries.push_back(std::make_unique<Entry>(Entry{hash, id, std::move(value)}));
+	Entry const* entry = entries.back().get();
+
+	other_items.set(id / 2, entry);
+	insert_in_buckets(entry, true);
+}
+
+void InternTable::clear()
+{
+	generation = next_generation++;
+	buckets.store(nullptr);
+	all_buckets.clear();
+	bucket_count = 0;
+	own_items.clear();
+	other_items.clear();
+	own_count = 0;
+	entries.clear();
+}
+}	 // namespace rd
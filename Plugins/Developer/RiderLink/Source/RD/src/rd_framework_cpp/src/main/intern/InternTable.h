@@ -0,0 +1,147 @@
+#ifndef RD_CPP_INTERNTABLE_H
+#define RD_CPP_INTERNTABLE_H
+
+#include "serialization/RdAny.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <rd_framework_export.h>
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4251)
+#endif
+
+namespace rd
+{
+/**
+ * \brief Append-only storage of interned values for \link rd::InternRoot.
+ *
+ * Lookups by id and by value never take a lock: entries are immutable once published and are
+ * only released by \link clear or destruction. Mutating calls must be serialized by the owner.
+ */
+class RD_FRAMEWORK_API InternTable
+{
+public:
+	struct Entry
+	{
+		size_t hash;
+		int32_t id;
+		InternedAny value;
+	};
+
+private:
+	/**
+	 * \brief Id-indexed slots split in power-of-two segments, so published slots never move.
+	 */
+	class SlotArray
+	{
+		static constexpr size_t FIRST_SEGMENT_BITS = 5;
+		static constexpr size_t SEGMENT_COUNT = 32;
+
+		std::atomic<std::atomic<Entry const*>*> segments[SEGMENT_COUNT];
+
+		static void locate(size_t index, size_t& segment, size_t& offset);
+
+	public:
+		SlotArray();
+
+		~SlotArray();
+
+		Entry const* get(size_t index) const;
+
+		void set(size_t index, Entry const* entry);
+
+		void clear();
+	};
+
+	/**
+	 * \brief Open-addressing index from value hash to entry. Grown by copy, old buckets are retired, not freed.
+	 */
+	struct Buckets
+	{
+		size_t mask;
+		std::unique_ptr<std::atomic<Entry const*>[]> slots;
+
+		explicit Buckets(size_t capacity);
+	};
+
+	static constexpr size_t INITIAL_BUCKETS = 64;
+
+	std::atomic<Buckets*> buckets{nullptr};
+	std::vector<std::unique_ptr<Buckets>> all_buckets;
+	size_t bucket_count = 0;
+
+	SlotArray own_items;
+	SlotArray other_items;
+	int32_t own_count = 0;
+
+	std::vector<std::unique_ptr<Entry>> entries;
+
+	/**
+	 * \brief Unique across all tables and bumped on \link clear, so per-thread caches never match stale entries.
+	 */
+	std::atomic<uint64_t> generation;
+
+	Entry const* find_in_buckets(InternedAny const& value, size_t hash) const;
+
+	void insert_in_buckets(Entry const* entry, bool overwrite);
+
+	void grow();
+
+public:
+	// region ctor/dtor
+
+	InternTable();
+
+	InternTable(InternTable const&) = delete;
+
+	InternTable& operator=(InternTable const&) = delete;
+
+	~InternTable();
+	// endregion
+
+	static size_t hash_of(InternedAny const& value);
+
+	static constexpr bool is_index_owned(int32_t id)
+	{
+		return !static_cast<bool>(id & 1);
+	}
+
+	/**
+	 * \brief Lock-free. Checks the calling thread's cache of recently interned values first.
+	 * \return id of [value] or -1 if it hasn't been interned on either side.
+	 */
+	int32_t find(InternedAny const& value, size_t hash) const;
+
+	/**
+	 * \brief Lock-free.
+	 * \return value interned with [id] or nullptr if it's unknown yet.
+	 */
+	InternedAny const* get(int32_t id) const;
+
+	/**
+	 * \brief Interns [value] on our side. Must be serialized with other mutating calls.
+	 * \return newly assigned (even) id.
+	 */
+	int32_t add_own(InternedAny value, size_t hash);
+
+	/**
+	 * \brief Records [value] interned by the counterpart with [id]. Must be serialized with other mutating calls.
+	 */
+	void add_other(int32_t id, InternedAny value, size_t hash);
+
+	/**
+	 * \brief Drops all entries. Must not race with readers.
+	 */
+	void clear();
+};
+}	 // namespace rd
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#endif	  // RD_CPP_INTERNTABLE_H
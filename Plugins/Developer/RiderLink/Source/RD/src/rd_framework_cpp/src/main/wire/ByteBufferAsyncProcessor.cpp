@@ -76,6 +76,44 @@ void ByteBufferAsyncProcessor::add_data(std::vector<Buffer::ByteArray>&& new_dat
 	//		}
 }
 
+void ByteBufferAsyncProcessor::trim_acknowledged()
+{
+	// queue_lock must be held by the caller
+	const sequence_number_t acknowledged = acknowledged_seqn.load();
+	while (current_seqn <= acknowledged && !pending_queue.empty())
+	{
+		backlog_bytes -= pending_queue.front().size();
+		--pending_count;
+		pending_queue.pop_front();
+		++current_seqn;
+	}
+}
+
+bool ByteBufferAsyncProcessor::has_backlog_room(size_t size) const
+{
+	const size_t current = backlog_bytes.load();
+	// a single message bigger than the whole window still has to go through
+	return current == 0 || current + size <= max_backlog_bytes;
+}
+
+void ByteBufferAsyncProcessor::flush_coalesced()
+{
+	// lock must be held by the caller
+	if (coalesced_low_priority.empty())
+	{
+		return;
+	}
+	const size_t size = coalesced_low_priority.size();
+	const size_t current = (backlog_bytes += size);
+	if (current > peak_backlog_bytes)
+	{
+		peak_backlog_bytes = current;
+	}
+	++queued_count;
+	data.emplace_back(std::move(coalesced_low_priority));
+	coalesced_low_priority = Buffer::ByteArray();
+}
+
 bool ByteBufferAsyncProcessor::reprocess()
 {
 	{
@@ -88,11 +126,7 @@ bool ByteBufferAsyncProcessor::reprocess()
 
 		logger->debug("{}: reprocessing waited for main processing", id);
 
-		while (current_seqn <= acknowledged_seqn)
-		{
-			pending_queue.pop_front();
-			++current_seqn;
-		}
+		trim_acknowledged();
 		for (int i = 0; i < pending_queue.size(); ++i)
 		{
 			auto const& item = pending_queue[i];
@@ -114,11 +148,15 @@ void ByteBufferAsyncProcessor::process()
 
 		logger->debug("{}: processing started", id);
 
+		trim_acknowledged();
+
 		while (!queue.empty() && processor(queue.front(), max_sent_seqn + 1))
 		{
 			++max_sent_seqn;
 			pending_queue.push_back(std::move(queue.front()));
 			queue.pop_front();
+			--queued_count;
+			++pending_count;
 		}
 	}
 	processing_cv.notify_all();
@@ -141,7 +179,7 @@ void ByteBufferAsyncProcessor::ThreadProc()
 				return;
 			}
 
-			while (data.empty() || interrupt_balance != 0)
+			while ((data.empty() && !acknowledge_received) || interrupt_balance != 0)
 			{
 				if (state >= StateKind::Stopping)
 				{
@@ -156,6 +194,11 @@ void ByteBufferAsyncProcessor::ThreadProc()
 					return;
 				}
 			}
+			acknowledge_received = false;
+			if (has_backlog_room(coalesced_low_priority.size()))
+			{
+				flush_coalesced();
+			}
 			add_data(std::move(data));
 			data.clear();
 		}
@@ -198,18 +241,57 @@ bool ByteBufferAsyncProcessor::terminate(time_t timeout)
 	return terminate0(timeout, StateKind::Terminating, "TERMINATE");
 }
 
-void ByteBufferAsyncProcessor::put(Buffer::ByteArray new_data)
+bool ByteBufferAsyncProcessor::put(Buffer::ByteArray new_data, Priority priority)
 {
 	{
 		std::lock_guard<decltype(lock)> guard(lock);
 
 		if (state >= StateKind::Stopping)
 		{
-			return;
+			return false;
 		}
+
+		const size_t size = new_data.size();
+		if (!has_backlog_room(size))
+		{
+			if (priority == Priority::Low && overflow_policy == OverflowPolicy::DropLowPriority)
+			{
+				if (coalesced_low_priority.size() + size <= max_coalesced_bytes)
+				{
+					coalesced_low_priority.insert(coalesced_low_priority.end(), new_data.begin(), new_data.end());
+					++coalesced_count;
+					return true;
+				}
+				++dropped_count;
+				logger->trace("{}: send window is full, dropped low priority message of {} bytes", id, size);
+				return false;
+			}
+
+			// Producers are never kept waiting: they are usually the game thread, and the counterpart may be gone for good
+			if (overflow_count++ == 0 || overflow_policy == OverflowPolicy::FailFast)
+			{
+				logger->warn("{}: send window of {} bytes is full, backlog: {} bytes", id, max_backlog_bytes, backlog_bytes.load());
+			}
+			if (overflow_policy == OverflowPolicy::FailFast)
+			{
+				++dropped_count;
+				return false;
+			}
+		}
+
+		// keep coalesced messages ahead of everything put after them
+		flush_coalesced();
+
+		const size_t current = (backlog_bytes += size);
+		if (current > peak_backlog_bytes)
+		{
+			peak_backlog_bytes = current;
+		}
+		++queued_count;
 		data.emplace_back(std::move(new_data));
 	}
 	cv.notify_all();
+	return true;
 }
 
 void ByteBufferAsyncProcessor::pause(const std::string& reason)
@@ -247,17 +329,47 @@ void ByteBufferAsyncProcessor::resume()
 
 void ByteBufferAsyncProcessor::acknowledge(sequence_number_t seqn)
 {
-	std::lock_guard<decltype(lock)> guard(lock);
-
-	if (seqn > acknowledged_seqn)
 	{
-		logger->trace("{}: new acknowledged seqn: {}", this->id, seqn);
-		acknowledged_seqn = seqn;
+		std::lock_guard<decltype(lock)> guard(lock);
+
+		if (seqn > acknowledged_seqn)
+		{
+			logger->trace("{}: new acknowledged seqn: {}", this->id, seqn);
+			acknowledged_seqn = seqn;
+			// wake up the async thread so it releases acknowledged messages
+			acknowledge_received = true;
+		}
+		else
+		{
+			logger->error("Acknowledge {} called, while next seqn MUST BE greater than {}", seqn, acknowledged_seqn.load());
+			return;
+		}
 	}
-	else
+	cv.notify_all();
+}
+
+void ByteBufferAsyncProcessor::set_send_window(size_t max_bytes, OverflowPolicy policy)
+{
 	{
-		logger->error("Acknowledge {} called, while next seqn MUST BE greater than {}", seqn, acknowledged_seqn);
+		std::lock_guard<decltype(lock)> guard(lock);
+
+		max_backlog_bytes = max_bytes;
+		overflow_policy = policy;
 	}
+	cv.notify_all();
+}
+
+ByteBufferAsyncProcessor::Stats ByteBufferAsyncProcessor::get_stats() const
+{
+	Stats stats;
+	stats.queued_count = queued_count.load();
+	stats.pending_count = pending_count.load();
+	stats.backlog_bytes = backlog_bytes.load();
+	stats.peak_backlog_bytes = peak_backlog_bytes.load();
+	stats.dropped_count = dropped_count.load();
+	stats.coalesced_count = coalesced_count.load();
+	stats.overflow_count = overflow_count.load();
+	return stats;
 }
 
 std::string to_string(ByteBufferAsyncProcessor::StateKind state)
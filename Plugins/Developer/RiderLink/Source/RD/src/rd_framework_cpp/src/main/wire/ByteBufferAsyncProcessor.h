@@ -15,6 +15,7 @@
 #include <condition_variable>
 #include <future>
 #include <list>
+#include <atomic>
 
 #include <rd_framework_export.h>
 
@@ -34,6 +35,37 @@ public:
 		Terminated
 	};
 
+	enum class Priority
+	{
+		Normal,
+		/// Traffic that may be coalesced or dropped once the backlog exceeds its budget (e.g. log events).
+		Low
+	};
+
+	enum class OverflowPolicy
+	{
+		/// Every message put past the send window is rejected and counted as overflow; the owner is expected to reset the connection.
+		FailFast,
+		/// Low priority traffic is coalesced and then dropped past the send window. Normal traffic is still queued,
+		/// because losing it would desynchronize the protocol, but it is counted as overflow.
+		DropLowPriority
+	};
+
+	struct Stats
+	{
+		/// Messages put but not yet sent.
+		size_t queued_count = 0;
+		/// Messages sent but not yet acknowledged by the counterpart.
+		size_t pending_count = 0;
+		/// Bytes of all messages which are either queued or pending.
+		size_t backlog_bytes = 0;
+		size_t peak_backlog_bytes = 0;
+		uint64_t dropped_count = 0;
+		uint64_t coalesced_count = 0;
+		/// Normal priority messages put while the send window was full.
+		uint64_t overflow_count = 0;
+	};
+
 private:
 	using time_t = std::chrono::milliseconds;
 
@@ -59,7 +91,21 @@ private:
 
 	sequence_number_t max_sent_seqn = 0;
 	sequence_number_t current_seqn = 1;
-	sequence_number_t acknowledged_seqn = 0;
+	std::atomic<sequence_number_t> acknowledged_seqn{0};
+	bool acknowledge_received = false;
+
+	size_t max_backlog_bytes = 64 * 1024 * 1024;
+	size_t max_coalesced_bytes = 1024 * 1024;
+	OverflowPolicy overflow_policy = OverflowPolicy::DropLowPriority;
+	Buffer::ByteArray coalesced_low_priority;
+
+	std::atomic<size_t> queued_count{0};
+	std::atomic<size_t> pending_count{0};
+	std::atomic<size_t> backlog_bytes{0};
+	std::atomic<size_t> peak_backlog_bytes{0};
+	std::atomic<uint64_t> dropped_count{0};
+	std::atomic<uint64_t> coalesced_count{0};
+	std::atomic<uint64_t> overflow_count{0};
 
 	int32_t interrupt_balance = 0;
 	bool in_processing = false;
@@ -79,6 +125,12 @@ private:
 
 	void add_data(std::vector<Buffer::ByteArray>&& new_data);
 
+	void trim_acknowledged();
+
+	bool has_backlog_room(size_t size) const;
+
+	void flush_coalesced();
+
 	bool reprocess();
 
 	void process();
@@ -92,13 +144,26 @@ public:
 
 	bool terminate(time_t timeout = time_t(0) /*InfiniteDuration*/);
 
-	void put(Buffer::ByteArray new_data);
+	/**
+	 * \brief Queues a message for sending. Never waits for the counterpart.
+	 * \return false if the message was dropped, either because the processor is stopping or by the overflow policy.
+	 */
+	bool put(Buffer::ByteArray new_data, Priority priority = Priority::Normal);
 
 	void pause(const std::string& reason);
 
 	void resume();
 
 	void acknowledge(int64_t seqn);
+
+	/**
+	 * \brief Bounds the memory held by messages which haven't been acknowledged by the counterpart yet.
+	 * \param max_bytes maximum size of queued and unacknowledged messages before the overflow policy kicks in.
+	 * \param policy what to do with new messages once the budget is exhausted.
+	 */
+	void set_send_window(size_t max_bytes, OverflowPolicy policy);
+
+	Stats get_stats() const;
 };
 
 std::string to_string(ByteBufferAsyncProcessor::StateKind state);
@@ -118,7 +118,32 @@ void SocketWire::Base::send(RdId const& rd_id, std::function<void(Buffer& buffer
 	local_send_buffer.rewind();
 	local_send_buffer.write_integral<int32_t>(len - 4);
 	local_send_buffer.set_position(len);
-	async_send_buffer.put(std::move(local_send_buffer).getRealArray());
+
+	auto priority = ByteBufferAsyncProcessor::Priority::Normal;
+	{
+		std::lock_guard<decltype(low_priority_lock)> guard(low_priority_lock);
+		if (!low_priority_ids.empty() && low_priority_ids.count(rd_id.get_hash()) > 0)
+		{
+			priority = ByteBufferAsyncProcessor::Priority::Low;
+		}
+	}
+	async_send_buffer.put(std::move(local_send_buffer).getRealArray(), priority);
+}
+
+void SocketWire::Base::set_low_priority(RdId const& rd_id)
+{
+	std::lock_guard<decltype(low_priority_lock)> guard(low_priority_lock);
+	low_priority_ids.insert(rd_id.get_hash());
+}
+
+void SocketWire::Base::set_send_window(size_t max_bytes, ByteBufferAsyncProcessor::OverflowPolicy policy)
+{
+	async_send_buffer.set_send_window(max_bytes, policy);
+}
+
+ByteBufferAsyncProcessor::Stats SocketWire::Base::get_send_stats() const
+{
+	return async_send_buffer.get_stats();
 }
 
 void SocketWire::Base::set_socket_provider(std::shared_ptr<CActiveSocket> new_socket)
@@ -14,6 +14,7 @@
 #include <string>
 #include <array>
 #include <condition_variable>
+#include <unordered_set>
 
 #include <rd_framework_export.h>
 
@@ -49,6 +50,9 @@ public:
 		mutable ByteBufferAsyncProcessor async_send_buffer{id + "-AsyncSendProcessor",
 			[this](Buffer::ByteArray const& it, sequence_number_t seqn) -> bool { return this->send0(it, seqn); }};
 
+		mutable std::mutex low_priority_lock;
+		std::unordered_set<RdId::hash_t> low_priority_ids;
+
 		static constexpr size_t RECEIVE_BUFFER_SIZE = 1u << 16;
 		mutable std::array<Buffer::word_t, RECEIVE_BUFFER_SIZE> receiver_buffer{};
 		mutable decltype(receiver_buffer)::iterator lo = receiver_buffer.begin(), hi = receiver_buffer.begin();
@@ -135,6 +139,15 @@ public:
 		bool send_ack(sequence_number_t seqn) const;
 
 		bool try_shutdown_connection() const;
+
+		/**
+		 * \brief Messages sent to [rd_id] may be coalesced or dropped when the counterpart stops acknowledging.
+		 */
+		void set_low_priority(RdId const& rd_id);
+
+		void set_send_window(size_t max_bytes, ByteBufferAsyncProcessor::OverflowPolicy policy);
+
+		ByteBufferAsyncProcessor::Stats get_send_stats() const;
 		
 	private:		
 		LifetimeDefinition lifetimeDef;
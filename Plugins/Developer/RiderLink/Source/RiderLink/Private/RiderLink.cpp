@@ -15,6 +15,8 @@ DEFINE_LOG_CATEGORY(FLogRiderLinkModule);
 
 IMPLEMENT_MODULE(FRiderLinkModule, RiderLink);
 
+static constexpr size_t RiderSendWindowBytes = 32 * 1024 * 1024;
+
 static FString GetProjectName()
 {
 	FString ProjectNameNoExtension = FApp::GetProjectName();
@@ -61,15 +63,24 @@ void FRiderLinkModule::InitProtocol()
 //			});
 //		}
 //	});
-	Protocol->wire->connected.view(WireLifetime, [this](rd::Lifetime ConnectionLifetime, bool const& IsConnected)
+	// Bound the memory kept for Rider while it doesn't acknowledge (e.g. suspended in a debugger);
+	// log events are the bulk of that traffic and may be coalesced or dropped instead of blocking the editor.
+	Wire->set_send_window(RiderSendWindowBytes, rd::ByteBufferAsyncProcessor::OverflowPolicy::DropLowPriority);
+	std::weak_ptr<rd::SocketWire::Server> WeakWire = Wire;
+	Protocol->wire->connected.view(WireLifetime, [this, WeakWire](rd::Lifetime ConnectionLifetime, bool const& IsConnected)
 	{
-		Scheduler.queue([this, ConnectionLifetime, IsConnected]()
+		Scheduler.queue([this, WeakWire, ConnectionLifetime, IsConnected]()
 		{
 			if (!IsConnected) return;
 
 			FRWScopeLock LockOnConnect(ModelLock, SLT_Write);
 			EditorModel = MakeUnique<JetBrains::EditorPlugin::RdEditorModel>();
 			EditorModel->connect(ConnectionLifetime, Protocol.Get());
+			if (const std::shared_ptr<rd::SocketWire::Server> ConnectedWire = WeakWire.lock())
+			{
+				const rd::IRdBindable& UnrealLog = dynamic_cast<const rd::IRdBindable&>(EditorModel->get_unrealLog());
+				ConnectedWire->set_low_priority(UnrealLog.get_id());
+			}
 			JetBrains::EditorPlugin::UE4Library::serializersOwner.registerSerializersCore(
 				EditorModel->get_serialization_context().get_serializers()
 			);
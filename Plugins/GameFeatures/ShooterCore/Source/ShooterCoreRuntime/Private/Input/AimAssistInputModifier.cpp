@@ -7,6 +7,7 @@
 #include "Engine/GameViewportClient.h"
 #include "Engine/World.h"
 #include "EnhancedPlayerInput.h"
+#include "GameFramework/PlayerController.h"
 #include "Input/AimAssistTargetManagerComponent.h"
 #include "Input/LyraAimSensitivityData.h"
 #include "Player/LyraLocalPlayer.h"
@@ -414,6 +415,214 @@ FBox2D FAimAssistOwnerViewData::ProjectCapsuleToScreen(const FCollisionShape& Sh
 	return Box2D;
 }
 
+int32 FAimAssistOwnerViewData::AddShapeToBatch(FAimAssistProjectionBatch& Batch, const FCollisionShape& Shape, const FVector& ShapeOrigin, const FTransform& WorldTransform) const
+{
+	const int32 FirstVertex = Batch.VertexX.Num();
+
+	auto AddVertex = [&Batch](const FVector& Vertex)
+	{
+		Batch.VertexX.Add(Vertex.X);
+		Batch.VertexY.Add(Vertex.Y);
+		Batch.VertexZ.Add(Vertex.Z);
+	};
+
+	switch (Shape.ShapeType)
+	{
+	case ECollisionShape::Box:
+	{
+		const FVector BoxExtents = Shape.GetBox();
+		for (int32 VerticeIndex = 0; VerticeIndex < 8; ++VerticeIndex)
+		{
+			const FVector Corner(
+				(VerticeIndex & 4) ? BoxExtents.X : -BoxExtents.X,
+				(VerticeIndex & 2) ? BoxExtents.Y : -BoxExtents.Y,
+				(VerticeIndex & 1) ? BoxExtents.Z : -BoxExtents.Z);
+			AddVertex(WorldTransform.TransformPositionNoScale(Corner + ShapeOrigin));
+		}
+		break;
+	}
+	case ECollisionShape::Sphere:
+	{
+		const float SphereRadius = Shape.GetSphereRadius();
+		const FVector SphereLocation = WorldTransform.TransformPositionNoScale(ShapeOrigin);
+		const FVector SphereExtent = (ViewTransform.GetUnitAxis(EAxis::Y) * SphereRadius) + (ViewTransform.GetUnitAxis(EAxis::Z) * SphereRadius);
+
+		AddVertex(SphereLocation + SphereExtent);
+		AddVertex(SphereLocation - SphereExtent);
+		break;
+	}
+	case ECollisionShape::Capsule:
+	{
+		const float CapsuleAxisHalfLength = Shape.GetCapsuleAxisHalfLength();
+		const float CapsuleRadius = Shape.GetCapsuleRadius();
+
+		const FVector TopSphereLocation = WorldTransform.TransformPositionNoScale(FVector(0.0f, 0.0f, CapsuleAxisHalfLength) + ShapeOrigin);
+		const FVector BottomSphereLocation = WorldTransform.TransformPositionNoScale(FVector(0.0f, 0.0f, -CapsuleAxisHalfLength) + ShapeOrigin);
+		const FVector SphereExtent = (ViewTransform.GetUnitAxis(EAxis::Y) * CapsuleRadius) + (ViewTransform.GetUnitAxis(EAxis::Z) * CapsuleRadius);
+
+		AddVertex(TopSphereLocation + SphereExtent);
+		AddVertex(TopSphereLocation - SphereExtent);
+		AddVertex(BottomSphereLocation + SphereExtent);
+		AddVertex(BottomSphereLocation - SphereExtent);
+		break;
+	}
+	default:
+		UE_LOG(LogAimAssist, Warning, TEXT("FAimAssistOwnerViewData::AddShapeToBatch() - Invalid shape type!"));
+		return INDEX_NONE;
+	}
+
+	Batch.ShapeFirstVertex.Add(FirstVertex);
+	return Batch.ShapeNumVertices.Add(Batch.VertexX.Num() - FirstVertex);
+}
+
+void FAimAssistOwnerViewData::ProjectBatchToScreen(FAimAssistProjectionBatch& Batch) const
+{
+	const int32 NumVertices = Batch.VertexX.Num();
+	Batch.ScreenX.SetNumUninitialized(NumVertices, EAllowShrinking::No);
+	Batch.ScreenY.SetNumUninitialized(NumVertices, EAllowShrinking::No);
+	Batch.bOnScreen.SetNumUninitialized(NumVertices, EAllowShrinking::No);
+
+	const FMatrix& M = ViewProjectionMatrix;
+	const double M00 = M.M[0][0], M10 = M.M[1][0], M20 = M.M[2][0], M30 = M.M[3][0];
+	const double M01 = M.M[0][1], M11 = M.M[1][1], M21 = M.M[2][1], M31 = M.M[3][1];
+	const double M03 = M.M[0][3], M13 = M.M[1][3], M23 = M.M[2][3], M33 = M.M[3][3];
+	const double ViewMinX = ViewRect.Min.X;
+	const double ViewMinY = ViewRect.Min.Y;
+	const double ViewWidth = ViewRect.Width();
+	const double ViewHeight = ViewRect.Height();
+
+	const double* RESTRICT VertexX = Batch.VertexX.GetData();
+	const double* RESTRICT VertexY = Batch.VertexY.GetData();
+	const double* RESTRICT VertexZ = Batch.VertexZ.GetData();
+	double* RESTRICT ScreenX = Batch.ScreenX.GetData();
+	double* RESTRICT ScreenY = Batch.ScreenY.GetData();
+	bool* RESTRICT bOnScreen = Batch.bOnScreen.GetData();
+
+	// Branch free over contiguous arrays so the compiler can vectorize it
+	for (int32 Index = 0; Index < NumVertices; ++Index)
+	{
+		const double X = VertexX[Index];
+		const double Y = VertexY[Index];
+		const double Z = VertexZ[Index];
+
+		const double ClipX = X * M00 + Y * M10 + Z * M20 + M30;
+		const double ClipY = X * M01 + Y * M11 + Z * M21 + M31;
+		const double ClipW = X * M03 + Y * M13 + Z * M23 + M33;
+
+		const bool bInFront = ClipW > 0.0;
+		const double RHW = 1.0 / (bInFront ? ClipW : 1.0);
+
+		ScreenX[Index] = ViewMinX + ((ClipX * RHW * 0.5) + 0.5) * ViewWidth;
+		ScreenY[Index] = ViewMinY + (0.5 - (ClipY * RHW * 0.5)) * ViewHeight;
+		bOnScreen[Index] = bInFront;
+	}
+}
+
+void FAimAssistProjectionBatch::Reset()
+{
+	ShapeFirstVertex.Reset();
+	ShapeNumVertices.Reset();
+	VertexX.Reset();
+	VertexY.Reset();
+	VertexZ.Reset();
+}
+
+FBox2D FAimAssistProjectionBatch::GetShapeScreenBounds(int32 ShapeIndex) const
+{
+	FBox2D Box2D(ForceInitToZero);
+
+	const int32 FirstVertex = ShapeFirstVertex[ShapeIndex];
+	const int32 EndVertex = FirstVertex + ShapeNumVertices[ShapeIndex];
+	for (int32 VertexIndex = FirstVertex; VertexIndex < EndVertex; ++VertexIndex)
+	{
+		if (bOnScreen[VertexIndex])
+		{
+			Box2D += FVector2D(ScreenX[VertexIndex], ScreenY[VertexIndex]);
+		}
+	}
+
+	return Box2D;
+}
+
+#if !UE_BUILD_SHIPPING
+namespace AimAssistProjectionBenchmark
+{
+	static void Run(const TArray<FString>& Args, UWorld* World)
+	{
+		APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+
+		FAimAssistOwnerViewData OwnerViewData;
+		OwnerViewData.UpdateViewData(PC);
+		if (!OwnerViewData.IsDataValid())
+		{
+			UE_LOG(LogAimAssist, Warning, TEXT("Aim assist projection benchmark needs a local player with a pawn."));
+			return;
+		}
+
+		const int32 Iterations = (Args.Num() > 0) ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 1000;
+		const FCollisionShape Shape = FCollisionShape::MakeCapsule(40.0f, 90.0f);
+		const FVector ViewLocation = OwnerViewData.ViewTransform.GetTranslation();
+		const FVector ViewForward = OwnerViewData.ViewForward;
+
+		FRandomStream Random(0x5A17);
+		FAimAssistProjectionBatch Batch;
+
+		for (const int32 NumTargets : { 8, 32, 128 })
+		{
+			// Capsules scattered in a cone in front of the view
+			TArray<FTransform> Transforms;
+			for (int32 TargetIndex = 0; TargetIndex < NumTargets; ++TargetIndex)
+			{
+				const FVector Direction = Random.VRandCone(ViewForward, FMath::DegreesToRadians(30.0f));
+				Transforms.Add(FTransform(ViewLocation + Direction * Random.FRandRange(500.0f, 5000.0f)));
+			}
+
+			FBox2D ScalarChecksum(ForceInitToZero);
+			const double ScalarStart = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				for (const FTransform& Transform : Transforms)
+				{
+					ScalarChecksum += OwnerViewData.ProjectShapeToScreen(Shape, FVector::ZeroVector, Transform);
+				}
+			}
+			const double ScalarSeconds = FPlatformTime::Seconds() - ScalarStart;
+
+			FBox2D BatchChecksum(ForceInitToZero);
+			const double BatchStart = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				Batch.Reset();
+				for (const FTransform& Transform : Transforms)
+				{
+					OwnerViewData.AddShapeToBatch(Batch, Shape, FVector::ZeroVector, Transform);
+				}
+
+				OwnerViewData.ProjectBatchToScreen(Batch);
+				for (int32 ShapeIndex = 0; ShapeIndex < Batch.NumShapes(); ++ShapeIndex)
+				{
+					BatchChecksum += Batch.GetShapeScreenBounds(ShapeIndex);
+				}
+			}
+			const double BatchSeconds = FPlatformTime::Seconds() - BatchStart;
+
+			UE_LOG(LogAimAssist, Display, TEXT("%3d targets: scalar %.2f us, batched %.2f us per update (%.2fx), checksums %s"),
+				NumTargets,
+				ScalarSeconds * 1e6 / Iterations,
+				BatchSeconds * 1e6 / Iterations,
+				(BatchSeconds > 0.0) ? (ScalarSeconds / BatchSeconds) : 0.0,
+				(ScalarChecksum.Min.Equals(BatchChecksum.Min, 0.5) && ScalarChecksum.Max.Equals(BatchChecksum.Max, 0.5)) ? TEXT("match") : TEXT("DIFFER"));
+		}
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs CmdBenchmarkProjection(
+		TEXT("lyra.Weapon.AimAssist.BenchmarkProjection"),
+		TEXT("Times the scalar and batched aim assist target projection at 8, 32 and 128 targets. Optional arg: iterations (default 1000)"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&Run),
+		ECVF_Cheat);
+}
+#endif // !UE_BUILD_SHIPPING
+
 ///////////////////////////////////////////////////////////////////
 // UAimAssistInputModifier
 
@@ -562,12 +771,12 @@ void UAimAssistInputModifier::UpdateTargetData(float DeltaTime)
 	// Update target weights.
 	//
 	float TotalAssistWeight = 0.0f;
+	const float MaxAssistTime = NewTargetCache.IsEmpty() ? 0.0f : Settings.GetTargetWeightMaxTime();
 
 	for (FLyraAimAssistTarget& Target : NewTargetCache)
 	{
 		if (Target.bUnderAssistOuterReticle && Target.bIsVisible)
 		{
-			const float MaxAssistTime = Settings.GetTargetWeightMaxTime();
 			Target.AssistTime = FMath::Min((Target.AssistTime + DeltaTime), MaxAssistTime);
 		}
 		else
@@ -625,6 +834,8 @@ FRotator UAimAssistInputModifier::UpdateRotationalVelocity(APlayerController* PC
 		SettingStrengthScalar = GetSensitivtyScalar(SharedSettings);
 	}
 	
+	const FAimAssistTargetStrengths Strengths = GetTargetStrengths();
+
 	for (const FLyraAimAssistTarget& Target : TargetCache)
 	{
 		if (Target.bUnderAssistOuterReticle && Target.bIsVisible)
@@ -634,7 +845,7 @@ FRotator UAimAssistInputModifier::UpdateRotationalVelocity(APlayerController* PC
 
 			float TargetPullStrength = 0.0f;
 			float TargetSlowStrength = 0.0f;
-			CalculateTargetStrengths(Target, TargetPullStrength, TargetSlowStrength);
+			CalculateTargetStrengths(Target, Strengths, TargetPullStrength, TargetSlowStrength);
 
 			// Add up total amount of weighted pull and slow from the targets.
 			PullStrength += TargetPullStrength;
@@ -756,35 +967,31 @@ FRotator UAimAssistInputModifier::UpdateRotationalVelocity(APlayerController* PC
 	return RotationalVelocity;
 }
 
-void UAimAssistInputModifier::CalculateTargetStrengths(const FLyraAimAssistTarget& Target, float& OutPullStrength, float& OutSlowStrength) const
+FAimAssistTargetStrengths UAimAssistInputModifier::GetTargetStrengths() const
 {
 	const bool bIsADS = (TargetingType == ELyraTargetingType::ADS);
-	
+
+	// Scalable floats may have to evaluate a curve table, so only do it once per update
+	FAimAssistTargetStrengths Strengths;
+	Strengths.PullInner = bIsADS ? Settings.PullInnerStrengthAds.GetValue() : Settings.PullInnerStrengthHip.GetValue();
+	Strengths.PullOuter = bIsADS ? Settings.PullOuterStrengthAds.GetValue() : Settings.PullOuterStrengthHip.GetValue();
+	Strengths.SlowInner = bIsADS ? Settings.SlowInnerStrengthAds.GetValue() : Settings.SlowInnerStrengthHip.GetValue();
+	Strengths.SlowOuter = bIsADS ? Settings.SlowOuterStrengthAds.GetValue() : Settings.SlowOuterStrengthHip.GetValue();
+
+	return Strengths;
+}
+
+void UAimAssistInputModifier::CalculateTargetStrengths(const FLyraAimAssistTarget& Target, const FAimAssistTargetStrengths& Strengths, float& OutPullStrength, float& OutSlowStrength) const
+{
 	if (Target.bUnderAssistInnerReticle)
 	{
-		if (bIsADS)
-		{
-			OutPullStrength = Settings.PullInnerStrengthAds.GetValue();
-			OutSlowStrength = Settings.SlowInnerStrengthAds.GetValue();
-		}
-		else
-		{
-			OutPullStrength = Settings.PullInnerStrengthHip.GetValue();
-			OutSlowStrength = Settings.SlowInnerStrengthHip.GetValue();
-		}
+		OutPullStrength = Strengths.PullInner;
+		OutSlowStrength = Strengths.SlowInner;
 	}
 	else if (Target.bUnderAssistOuterReticle)
 	{
-		if (bIsADS)
-		{
-			OutPullStrength = Settings.PullOuterStrengthAds.GetValue();
-			OutSlowStrength = Settings.SlowOuterStrengthAds.GetValue();
-		}
-		else
-		{
-			OutPullStrength = Settings.PullOuterStrengthHip.GetValue();
-			OutSlowStrength = Settings.SlowOuterStrengthHip.GetValue();
-		}
+		OutPullStrength = Strengths.PullOuter;
+		OutSlowStrength = Strengths.SlowOuter;
 	}
 	else
 	{
@@ -167,9 +167,20 @@ void UAimAssistTargetManagerComponent::GetVisibleTargets(const FAimAssistFilter&
 	}
 	
 	// Gather targets that are in front of the player
+	struct FCandidateTarget
+	{
+		const FAimAssistTargetOptions* Options;
+		FVector Location;
+		float ViewDistance;
+		float ViewDot;
+		int32 ShapeIndex;
+	};
+
+	static TArray<FCandidateTarget> Candidates;
+	static FAimAssistProjectionBatch ProjectionBatch;
+	Candidates.Reset();
+	ProjectionBatch.Reset();
 	{
-		const FVector PawnLocation = OwnerPawn->GetActorLocation();		
-		
 		for (FAimAssistTargetOptions& AimAssistTarget : NewTargetData)
 		{
 			if (!DoesTargetPassFilter(OwnerData, Filter, AimAssistTarget, TargetRange))
@@ -199,25 +210,25 @@ void UAimAssistTargetManagerComponent::GetVisibleTargets(const FAimAssistFilter&
 			{
 				continue;
 			}
-			
-			const FLyraAimAssistTarget* OldTarget = FindTarget(OldTargets, AimAssistTarget.TargetShapeComponent.Get());
 
-			// Calculate the screen bounds for this target
-			FBox2D TargetScreenBounds(ForceInitToZero);
-			const bool bUpdateTargetProjections = true;
-			if (bUpdateTargetProjections)
+			// The screen bounds of all the candidates are projected together below
+			const int32 ShapeIndex = OwnerData.AddShapeToBatch(ProjectionBatch, TargetShape, TargetShapeOrigin, TargetTransform);
+			if (ShapeIndex == INDEX_NONE)
 			{
-				TargetScreenBounds = OwnerData.ProjectShapeToScreen(TargetShape, TargetShapeOrigin, TargetTransform);
-			}
-			else
-			{
-				// Target projections are not being updated so use the values from the previous frame if the target existed.
-				if (OldTarget)
-				{
-					TargetScreenBounds = OldTarget->ScreenBounds;
-				}
+				continue;
 			}
 
+			Candidates.Add({ &AimAssistTarget, TargetTransform.GetTranslation(), TargetViewDistance, TargetViewDot, ShapeIndex });
+		}
+	}
+
+	OwnerData.ProjectBatchToScreen(ProjectionBatch);
+
+	{
+		for (const FCandidateTarget& Candidate : Candidates)
+		{
+			// Calculate the screen bounds for this target
+			const FBox2D TargetScreenBounds = ProjectionBatch.GetShapeScreenBounds(Candidate.ShapeIndex);
 			if (!TargetScreenBounds.bIsValid)
 			{
 				continue;
@@ -228,12 +239,15 @@ void UAimAssistTargetManagerComponent::GetVisibleTargets(const FAimAssistFilter&
 				continue;
 			}
 
+			const FAimAssistTargetOptions& AimAssistTarget = *Candidate.Options;
+			const FLyraAimAssistTarget* OldTarget = FindTarget(OldTargets, AimAssistTarget.TargetShapeComponent.Get());
+
 			FLyraAimAssistTarget NewTarget;
 
 			NewTarget.TargetShapeComponent = AimAssistTarget.TargetShapeComponent;
-			NewTarget.Location = TargetTransform.GetTranslation();
+			NewTarget.Location = Candidate.Location;
 			NewTarget.ScreenBounds = TargetScreenBounds;
-			NewTarget.ViewDistance = TargetViewDistance;
+			NewTarget.ViewDistance = Candidate.ViewDistance;
 			NewTarget.bUnderAssistInnerReticle = AssistInnerReticleBounds.Intersect(TargetScreenBounds);
 			NewTarget.bUnderAssistOuterReticle = AssistOuterReticleBounds.Intersect(TargetScreenBounds);
 			
@@ -248,8 +262,8 @@ void UAimAssistTargetManagerComponent::GetVisibleTargets(const FAimAssistFilter&
 
 			// Calculate a score used for sorting based on previous weight, distance from target, and distance from reticle.
 			const float AssistWeightScore = (NewTarget.AssistWeight * Settings.TargetScore_AssistWeight);
-			const float ViewDotScore = ((TargetViewDot * Settings.TargetScore_ViewDot) - Settings.TargetScore_ViewDotOffset);
-			const float ViewDistanceScore = ((1.0f - (TargetViewDistance / TargetRange)) * Settings.TargetScore_ViewDistance);
+			const float ViewDotScore = ((Candidate.ViewDot * Settings.TargetScore_ViewDot) - Settings.TargetScore_ViewDotOffset);
+			const float ViewDistanceScore = ((1.0f - (Candidate.ViewDistance / TargetRange)) * Settings.TargetScore_ViewDistance);
 
 			NewTarget.SortScore = (AssistWeightScore + ViewDotScore + ViewDistanceScore);
 
@@ -3,6 +3,8 @@
 #include "LyraWorldCollectable.h"
 
 #include "Async/TaskGraphInterfaces.h"
+#include "Engine/World.h"
+#include "Interaction/LyraInteractionSubsystem.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(LyraWorldCollectable)
 
@@ -12,6 +14,26 @@ ALyraWorldCollectable::ALyraWorldCollectable()
 {
 }
 
+void ALyraWorldCollectable::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (ULyraInteractionSubsystem* InteractionSubsystem = UWorld::GetSubsystem<ULyraInteractionSubsystem>(GetWorld()))
+	{
+		InteractionSubsystem->RegisterInteractable(this);
+	}
+}
+
+void ALyraWorldCollectable::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (ULyraInteractionSubsystem* InteractionSubsystem = UWorld::GetSubsystem<ULyraInteractionSubsystem>(GetWorld()))
+	{
+		InteractionSubsystem->UnregisterInteractable(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void ALyraWorldCollectable::GatherInteractionOptions(const FInteractionQuery& InteractQuery, FInteractionOptionBuilder& InteractionBuilder)
 {
 	InteractionBuilder.AddInteractionOption(Option);
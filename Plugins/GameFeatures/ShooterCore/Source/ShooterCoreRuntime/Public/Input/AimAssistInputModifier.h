@@ -19,6 +19,32 @@ class ULyraSettingsShared;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogAimAssist, Log, All);
 
+/**
+ * Bounding vertices of several target shapes, laid out as a structure of arrays so they can all be
+ * projected to the screen in a single pass. See FAimAssistOwnerViewData::ProjectBatchToScreen.
+ */
+struct FAimAssistProjectionBatch
+{
+	void Reset();
+
+	int32 NumShapes() const { return ShapeFirstVertex.Num(); }
+
+	/** Screen bounds of the vertices of a shape that were in front of the view, invalid if none were */
+	FBox2D GetShapeScreenBounds(int32 ShapeIndex) const;
+
+	// One entry per shape
+	TArray<int32> ShapeFirstVertex;
+	TArray<int32> ShapeNumVertices;
+
+	// One entry per vertex
+	TArray<double> VertexX;
+	TArray<double> VertexY;
+	TArray<double> VertexZ;
+	TArray<double> ScreenX;
+	TArray<double> ScreenY;
+	TArray<bool> bOnScreen;
+};
+
 /** A container for some commonly used viewport data based on the current pawn */
 struct FAimAssistOwnerViewData
 {
@@ -43,6 +69,12 @@ struct FAimAssistOwnerViewData
 	FBox2D ProjectSphereToScreen(const FCollisionShape& Shape, const FVector& ShapeOrigin, const FTransform& WorldTransform) const;
 	FBox2D ProjectCapsuleToScreen(const FCollisionShape& Shape, const FVector& ShapeOrigin, const FTransform& WorldTransform) const;
 
+	/** Adds the vertices bounding this shape to the batch, returns the shape's index in it or INDEX_NONE if the shape type isn't supported */
+	int32 AddShapeToBatch(FAimAssistProjectionBatch& Batch, const FCollisionShape& Shape, const FVector& ShapeOrigin, const FTransform& WorldTransform) const;
+
+	/** Projects every vertex of the batch, same results as FSceneView::ProjectWorldToScreen on each of them */
+	void ProjectBatchToScreen(FAimAssistProjectionBatch& Batch) const;
+
 	/** Pointer to the player controller that can be used to calculate the data we need to check for visible targets */
 	const APlayerController* PlayerController = nullptr;
 
@@ -319,6 +351,15 @@ struct FAimAssistSettings
 	uint8 bUseRadialLookRates : 1;
 };
 
+/** Pull and slow strengths for the current targeting type, resolved once per update instead of once per target */
+struct FAimAssistTargetStrengths
+{
+	float PullInner = 0.0f;
+	float PullOuter = 0.0f;
+	float SlowInner = 0.0f;
+	float SlowOuter = 0.0f;
+};
+
 /**
  * An input modifier to help gamepad players have better targeting.
  */
@@ -360,8 +401,11 @@ protected:
 
 	FRotator UpdateRotationalVelocity(APlayerController* PC, float DeltaTime, FVector CurrentLookInputValue, FVector CurrentMoveInputValue);
 
+	/** Resolves the pull and slow strengths of the current targeting type */
+	FAimAssistTargetStrengths GetTargetStrengths() const;
+
 	/** Calcualte the pull and slow strengh of a given target */
-	void CalculateTargetStrengths(const FLyraAimAssistTarget& Target, float& OutPullStrength, float& OutSlowStrength) const;
+	void CalculateTargetStrengths(const FLyraAimAssistTarget& Target, const FAimAssistTargetStrengths& Strengths, float& OutPullStrength, float& OutSlowStrength) const;
 
 	FRotator GetLookRates(const FVector& LookInput);
 	
@@ -376,7 +420,11 @@ protected:
 
 	const float GetSensitivtyScalar(const ULyraSettingsShared* SharedSettings) const;
 	
-	// Tracking of the current and previous frame's targets
+	// Tracking of the current and previous frame's targets.
+	// These stay an array of structs on purpose: they are capped at Settings.MaxNumberOfTargets (6 by default) after
+	// the batched projection has already culled every candidate, and each entry is consumed as a whole by the sort,
+	// the old target lookup and the async visibility traces. The per-vertex projection is the only loop wide enough to
+	// benefit from a structure-of-arrays layout.
 	UPROPERTY()
 	TArray<FLyraAimAssistTarget> TargetCache0;
 
@@ -26,3 +26,17 @@ ULyraAbilitySystemComponent* ULyraAttributeSet::GetLyraAbilitySystemComponent()
 	return Cast<ULyraAbilitySystemComponent>(GetOwningAbilitySystemComponent());
 }
 
+void ULyraAttributeSet::ResetToDefaults()
+{
+	const UObject* DefaultSet = GetClass()->GetDefaultObject();
+
+	for (TFieldIterator<FProperty> It(GetClass(), EFieldIteratorFlags::IncludeSuper); It; ++It)
+	{
+		FProperty* Property = *It;
+		if (Property->GetOwnerClass()->IsChildOf(ULyraAttributeSet::StaticClass()))
+		{
+			Property->CopyCompleteValue_InContainer(this, DefaultSet);
+		}
+	}
+}
+
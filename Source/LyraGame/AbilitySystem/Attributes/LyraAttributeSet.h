@@ -60,6 +60,9 @@ public:
 	UE_API UWorld* GetWorld() const override;
 
 	UE_API ULyraAbilitySystemComponent* GetLyraAbilitySystemComponent() const;
+
+	// Restores the attributes to their class defaults, called when a pooled set is granted again
+	UE_API virtual void ResetToDefaults();
 };
 
 #undef UE_API
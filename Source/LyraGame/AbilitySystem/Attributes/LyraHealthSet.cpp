@@ -27,6 +27,15 @@ ULyraHealthSet::ULyraHealthSet()
 	HealthBeforeAttributeChange = 0.0f;
 }
 
+void ULyraHealthSet::ResetToDefaults()
+{
+	Super::ResetToDefaults();
+
+	bOutOfHealth = false;
+	MaxHealthBeforeAttributeChange = 0.0f;
+	HealthBeforeAttributeChange = 0.0f;
+}
+
 void ULyraHealthSet::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
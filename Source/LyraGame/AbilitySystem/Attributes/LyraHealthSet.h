@@ -51,6 +51,10 @@ public:
 	// Delegate to broadcast when the health attribute reaches zero
 	mutable FLyraAttributeEvent OnOutOfHealth;
 
+	//~ULyraAttributeSet interface
+	UE_API virtual void ResetToDefaults() override;
+	//~End of ULyraAttributeSet interface
+
 protected:
 
 	UFUNCTION()
@@ -3,6 +3,7 @@
 #include "LyraAbilitySet.h"
 
 #include "AbilitySystem/Abilities/LyraGameplayAbility.h"
+#include "GameplayCueManager.h"
 #include "LyraAbilitySystemComponent.h"
 #include "LyraLogChannels.h"
 
@@ -57,7 +58,7 @@ void FLyraAbilitySet_GrantedHandles::TakeFromAbilitySystem(ULyraAbilitySystemCom
 
 	for (UAttributeSet* Set : GrantedAttributeSets)
 	{
-		LyraASC->RemoveSpawnedAttribute(Set);
+		LyraASC->ReleaseAttributeSet(Set);
 	}
 
 	AbilitySpecHandles.Reset();
@@ -91,7 +92,7 @@ void ULyraAbilitySet::GiveToAbilitySystem(ULyraAbilitySystemComponent* LyraASC,
 			continue;
 		}
 
-		UAttributeSet* NewSet = NewObject<UAttributeSet>(LyraASC->GetOwner(), SetToGrant.AttributeSet);
+		UAttributeSet* NewSet = LyraASC->AcquireAttributeSet(SetToGrant.AttributeSet);
 		LyraASC->AddAttributeSetSubobject(NewSet);
 
 		if (OutGrantedHandles)
@@ -101,6 +102,9 @@ void ULyraAbilitySet::GiveToAbilitySystem(ULyraAbilitySystemComponent* LyraASC,
 	}
 
 	// Grant the gameplay abilities.
+	TArray<FGameplayAbilitySpec, TInlineAllocator<16>> AbilitySpecs;
+	AbilitySpecs.Reserve(GrantedGameplayAbilities.Num());
+
 	for (int32 AbilityIndex = 0; AbilityIndex < GrantedGameplayAbilities.Num(); ++AbilityIndex)
 	{
 		const FLyraAbilitySet_GameplayAbility& AbilityToGrant = GrantedGameplayAbilities[AbilityIndex];
@@ -113,19 +117,27 @@ void ULyraAbilitySet::GiveToAbilitySystem(ULyraAbilitySystemComponent* LyraASC,
 
 		ULyraGameplayAbility* AbilityCDO = AbilityToGrant.Ability->GetDefaultObject<ULyraGameplayAbility>();
 
-		FGameplayAbilitySpec AbilitySpec(AbilityCDO, AbilityToGrant.AbilityLevel);
+		FGameplayAbilitySpec& AbilitySpec = AbilitySpecs.Emplace_GetRef(AbilityCDO, AbilityToGrant.AbilityLevel);
 		AbilitySpec.SourceObject = SourceObject;
 		AbilitySpec.GetDynamicSpecSourceTags().AddTag(AbilityToGrant.InputTag);
+	}
 
-		const FGameplayAbilitySpecHandle AbilitySpecHandle = LyraASC->GiveAbility(AbilitySpec);
+	TArray<FGameplayAbilitySpecHandle> AbilitySpecHandles;
+	LyraASC->GiveAbilities(AbilitySpecs, AbilitySpecHandles);
 
-		if (OutGrantedHandles)
+	if (OutGrantedHandles)
+	{
+		for (const FGameplayAbilitySpecHandle& AbilitySpecHandle : AbilitySpecHandles)
 		{
 			OutGrantedHandles->AddAbilitySpecHandle(AbilitySpecHandle);
 		}
 	}
 
 	// Grant the gameplay effects.
+	// They share one effect context and their gameplay cues are sent together.
+	FScopedGameplayCueSendContext GameplayCueSendContext;
+	const FGameplayEffectContextHandle EffectContext = LyraASC->MakeEffectContext();
+
 	for (int32 EffectIndex = 0; EffectIndex < GrantedGameplayEffects.Num(); ++EffectIndex)
 	{
 		const FLyraAbilitySet_GameplayEffect& EffectToGrant = GrantedGameplayEffects[EffectIndex];
@@ -137,7 +149,7 @@ void ULyraAbilitySet::GiveToAbilitySystem(ULyraAbilitySystemComponent* LyraASC,
 		}
 
 		const UGameplayEffect* GameplayEffect = EffectToGrant.GameplayEffect->GetDefaultObject<UGameplayEffect>();
-		const FActiveGameplayEffectHandle GameplayEffectHandle = LyraASC->ApplyGameplayEffectToSelf(GameplayEffect, EffectToGrant.EffectLevel, LyraASC->MakeEffectContext());
+		const FActiveGameplayEffectHandle GameplayEffectHandle = LyraASC->ApplyGameplayEffectToSelf(GameplayEffect, EffectToGrant.EffectLevel, EffectContext);
 
 		if (OutGrantedHandles)
 		{
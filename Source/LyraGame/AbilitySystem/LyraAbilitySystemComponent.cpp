@@ -3,6 +3,7 @@
 #include "LyraAbilitySystemComponent.h"
 
 #include "AbilitySystem/Abilities/LyraGameplayAbility.h"
+#include "AbilitySystem/Attributes/LyraAttributeSet.h"
 #include "AbilitySystem/LyraAbilityTagRelationshipMapping.h"
 #include "Animation/LyraAnimInstance.h"
 #include "Engine/World.h"
@@ -16,6 +17,23 @@
 
 UE_DEFINE_GAMEPLAY_TAG(TAG_Gameplay_AbilityInputBlocked, "Gameplay.AbilityInputBlocked");
 
+namespace LyraAbilitySystemComponent
+{
+	static bool bBatchInputActivationRPCs = true;
+	static FAutoConsoleVariableRef CVarBatchInputActivationRPCs(
+		TEXT("Lyra.AbilitySystem.BatchInputActivationRPCs"),
+		bBatchInputActivationRPCs,
+		TEXT("Should abilities activated from input send their activation, target data and end ability to the server as one batched RPC"),
+		ECVF_Default);
+
+	static int32 MaxPooledAttributeSets = 8;
+	static FAutoConsoleVariableRef CVarMaxPooledAttributeSets(
+		TEXT("Lyra.AbilitySystem.MaxPooledAttributeSets"),
+		MaxPooledAttributeSets,
+		TEXT("Number of taken away attribute sets each ability system component keeps for reuse (0 disables pooling)"),
+		ECVF_Default);
+}
+
 ULyraAbilitySystemComponent::ULyraAbilitySystemComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -94,6 +112,55 @@ void ULyraAbilitySystemComponent::TryActivateAbilitiesOnSpawn()
 	}
 }
 
+void ULyraAbilitySystemComponent::GiveAbilities(TArrayView<FGameplayAbilitySpec> AbilitySpecs, TArray<FGameplayAbilitySpecHandle>& OutHandles)
+{
+	// Grow the replicated ability list once for the whole batch
+	ActivatableAbilities.Items.Reserve(ActivatableAbilities.Items.Num() + AbilitySpecs.Num());
+	OutHandles.Reserve(OutHandles.Num() + AbilitySpecs.Num());
+
+	for (FGameplayAbilitySpec& AbilitySpec : AbilitySpecs)
+	{
+		OutHandles.Add(GiveAbility(AbilitySpec));
+	}
+}
+
+UAttributeSet* ULyraAbilitySystemComponent::AcquireAttributeSet(TSubclassOf<UAttributeSet> SetClass)
+{
+	check(SetClass);
+
+	const int32 PooledIndex = PooledAttributeSets.IndexOfByPredicate([SetClass](const ULyraAttributeSet* PooledSet)
+		{
+			return PooledSet && (PooledSet->GetClass() == SetClass);
+		});
+
+	if (PooledIndex != INDEX_NONE)
+	{
+		ULyraAttributeSet* PooledSet = PooledAttributeSets[PooledIndex];
+		PooledAttributeSets.RemoveAtSwap(PooledIndex);
+
+		PooledSet->ResetToDefaults();
+		return PooledSet;
+	}
+
+	return NewObject<UAttributeSet>(GetOwner(), SetClass);
+}
+
+void ULyraAbilitySystemComponent::ReleaseAttributeSet(UAttributeSet* Set)
+{
+	if (Set == nullptr)
+	{
+		return;
+	}
+
+	RemoveSpawnedAttribute(Set);
+
+	ULyraAttributeSet* LyraSet = Cast<ULyraAttributeSet>(Set);
+	if (LyraSet && (PooledAttributeSets.Num() < LyraAbilitySystemComponent::MaxPooledAttributeSets))
+	{
+		PooledAttributeSets.Add(LyraSet);
+	}
+}
+
 void ULyraAbilitySystemComponent::CancelAbilitiesByFunc(TShouldCancelAbilityFunc ShouldCancelFunc, bool bReplicateCancelAbility)
 {
 	ABILITYLIST_SCOPE_LOCK();
@@ -147,6 +214,35 @@ void ULyraAbilitySystemComponent::CancelInputActivatedAbilities(bool bReplicateC
 	CancelAbilitiesByFunc(ShouldCancelFunc, bReplicateCancelAbility);
 }
 
+void ULyraAbilitySystemComponent::OnGiveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	Super::OnGiveAbility(AbilitySpec);
+
+	for (const FGameplayTag& Tag : AbilitySpec.GetDynamicSpecSourceTags())
+	{
+		InputTagToSpecHandles.AddUnique(Tag, AbilitySpec.Handle);
+	}
+}
+
+void ULyraAbilitySystemComponent::OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	// Don't rely on the spec tags still matching what was indexed when the ability was given
+	for (auto It = InputTagToSpecHandles.CreateIterator(); It; ++It)
+	{
+		if (It.Value() == AbilitySpec.Handle)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	Super::OnRemoveAbility(AbilitySpec);
+}
+
+bool ULyraAbilitySystemComponent::ShouldDoServerAbilityRPCBatch() const
+{
+	return LyraAbilitySystemComponent::bBatchInputActivationRPCs;
+}
+
 void ULyraAbilitySystemComponent::AbilitySpecInputPressed(FGameplayAbilitySpec& Spec)
 {
 	Super::AbilitySpecInputPressed(Spec);
@@ -187,13 +283,10 @@ void ULyraAbilitySystemComponent::AbilityInputTagPressed(const FGameplayTag& Inp
 {
 	if (InputTag.IsValid())
 	{
-		for (const FGameplayAbilitySpec& AbilitySpec : ActivatableAbilities.Items)
+		for (auto It = InputTagToSpecHandles.CreateConstKeyIterator(InputTag); It; ++It)
 		{
-			if (AbilitySpec.Ability && (AbilitySpec.GetDynamicSpecSourceTags().HasTagExact(InputTag)))
-			{
-				InputPressedSpecHandles.AddUnique(AbilitySpec.Handle);
-				InputHeldSpecHandles.AddUnique(AbilitySpec.Handle);
-			}
+			InputPressedSpecHandles.AddUnique(It.Value());
+			InputHeldSpecHandles.AddUnique(It.Value());
 		}
 	}
 }
@@ -202,13 +295,10 @@ void ULyraAbilitySystemComponent::AbilityInputTagReleased(const FGameplayTag& In
 {
 	if (InputTag.IsValid())
 	{
-		for (const FGameplayAbilitySpec& AbilitySpec : ActivatableAbilities.Items)
+		for (auto It = InputTagToSpecHandles.CreateConstKeyIterator(InputTag); It; ++It)
 		{
-			if (AbilitySpec.Ability && (AbilitySpec.GetDynamicSpecSourceTags().HasTagExact(InputTag)))
-			{
-				InputReleasedSpecHandles.AddUnique(AbilitySpec.Handle);
-				InputHeldSpecHandles.Remove(AbilitySpec.Handle);
-			}
+			InputReleasedSpecHandles.AddUnique(It.Value());
+			InputHeldSpecHandles.Remove(It.Value());
 		}
 	}
 }
@@ -224,8 +314,6 @@ void ULyraAbilitySystemComponent::ProcessAbilityInput(float DeltaTime, bool bGam
 	static TArray<FGameplayAbilitySpecHandle> AbilitiesToActivate;
 	AbilitiesToActivate.Reset();
 
-	//@TODO: See if we can use FScopedServerAbilityRPCBatcher ScopedRPCBatcher in some of these loops
-
 	//
 	// Process all abilities that activate when the input is held.
 	//
@@ -278,8 +366,11 @@ void ULyraAbilitySystemComponent::ProcessAbilityInput(float DeltaTime, bool bGam
 	// We do it all at once so that held inputs don't activate the ability
 	// and then also send a input event to the ability because of the press.
 	//
+	// Each activation is batched so the activation, any target data and the end of a short ability reach the server as one RPC.
+	//
 	for (const FGameplayAbilitySpecHandle& AbilitySpecHandle : AbilitiesToActivate)
 	{
+		FScopedServerAbilityRPCBatcher ScopedRPCBatcher(this, AbilitySpecHandle);
 		TryActivateAbility(AbilitySpecHandle);
 	}
 
@@ -11,7 +11,9 @@
 #define UE_API LYRAGAME_API
 
 class AActor;
+class UAttributeSet;
 class UGameplayAbility;
+class ULyraAttributeSet;
 class ULyraAbilityTagRelationshipMapping;
 class UObject;
 struct FFrame;
@@ -72,11 +74,25 @@ public:
 
 	UE_API void TryActivateAbilitiesOnSpawn();
 
+	/** Grants several abilities at once, OutHandles receives their handles in the same order */
+	UE_API void GiveAbilities(TArrayView<FGameplayAbilitySpec> AbilitySpecs, TArray<FGameplayAbilitySpecHandle>& OutHandles);
+
+	/** Returns a released attribute set of the given class if there is one, otherwise creates a new one. The caller adds it to the component. */
+	UE_API UAttributeSet* AcquireAttributeSet(TSubclassOf<UAttributeSet> SetClass);
+
+	/** Removes a granted attribute set from the component and keeps it for the next grant of the same class */
+	UE_API void ReleaseAttributeSet(UAttributeSet* Set);
+
 protected:
 
+	UE_API virtual void OnGiveAbility(FGameplayAbilitySpec& AbilitySpec) override;
+	UE_API virtual void OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec) override;
+
 	UE_API virtual void AbilitySpecInputPressed(FGameplayAbilitySpec& Spec) override;
 	UE_API virtual void AbilitySpecInputReleased(FGameplayAbilitySpec& Spec) override;
 
+	UE_API virtual bool ShouldDoServerAbilityRPCBatch() const override;
+
 	UE_API virtual void NotifyAbilityActivated(const FGameplayAbilitySpecHandle Handle, UGameplayAbility* Ability) override;
 	UE_API virtual void NotifyAbilityFailed(const FGameplayAbilitySpecHandle Handle, UGameplayAbility* Ability, const FGameplayTagContainer& FailureReason) override;
 	UE_API virtual void NotifyAbilityEnded(FGameplayAbilitySpecHandle Handle, UGameplayAbility* Ability, bool bWasCancelled) override;
@@ -94,6 +110,10 @@ protected:
 	UPROPERTY()
 	TObjectPtr<ULyraAbilityTagRelationshipMapping> TagRelationshipMapping;
 
+	// Handles of granted abilities by each of their dynamic source tags, which is where input tags are stored.
+	// Kept up to date as abilities are given and removed (on clients too, through replication).
+	TMultiMap<FGameplayTag, FGameplayAbilitySpecHandle> InputTagToSpecHandles;
+
 	// Handles to abilities that had their input pressed this frame.
 	TArray<FGameplayAbilitySpecHandle> InputPressedSpecHandles;
 
@@ -105,6 +125,10 @@ protected:
 
 	// Number of abilities running in each activation group.
 	int32 ActivationGroupCounts[(uint8)ELyraAbilityActivationGroup::MAX];
+
+	// Attribute sets taken away from this component, reused by later grants (e.g., the next respawn)
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ULyraAttributeSet>> PooledAttributeSets;
 };
 
 #undef UE_API
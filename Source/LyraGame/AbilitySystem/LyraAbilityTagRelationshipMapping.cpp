@@ -5,59 +5,117 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(LyraAbilityTagRelationshipMapping)
 
-void ULyraAbilityTagRelationshipMapping::GetAbilityTagsToBlockAndCancel(const FGameplayTagContainer& AbilityTags, FGameplayTagContainer* OutTagsToBlock, FGameplayTagContainer* OutTagsToCancel) const
+void ULyraAbilityTagRelationshipMapping::PostLoad()
+{
+	Super::PostLoad();
+
+	CompileRelationships();
+}
+
+#if WITH_EDITOR
+void ULyraAbilityTagRelationshipMapping::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
-	// Simple iteration for now
-	for (int32 i = 0; i < AbilityTagRelationships.Num(); i++)
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	bRelationshipsCompiled = false;
+}
+#endif
+
+void ULyraAbilityTagRelationshipMapping::CompileRelationships() const
+{
+	CompiledRelationships.Reset();
+	CancelTagsByActionTag.Reset();
+	bRelationshipsCompiled = true;
+
+	for (const FLyraAbilityTagRelationship& Tags : AbilityTagRelationships)
 	{
-		const FLyraAbilityTagRelationship& Tags = AbilityTagRelationships[i];
-		if (AbilityTags.HasTag(Tags.AbilityTag))
+		if (Tags.AbilityTag.IsValid())
 		{
-			if (OutTagsToBlock)
-			{
-				OutTagsToBlock->AppendTags(Tags.AbilityTagsToBlock);
-			}
-			if (OutTagsToCancel)
-			{
-				OutTagsToCancel->AppendTags(Tags.AbilityTagsToCancel);
-			}
+			CancelTagsByActionTag.FindOrAdd(Tags.AbilityTag).AppendTags(Tags.AbilityTagsToCancel);
 		}
 	}
+
+	// Abilities usually carry the relationship tags themselves, so have those ready up front
+	for (const TPair<FGameplayTag, FGameplayTagContainer>& Pair : CancelTagsByActionTag)
+	{
+		FindOrCompileRelationship(Pair.Key);
+	}
 }
 
-void ULyraAbilityTagRelationshipMapping::GetRequiredAndBlockedActivationTags(const FGameplayTagContainer& AbilityTags, FGameplayTagContainer* OutActivationRequired, FGameplayTagContainer* OutActivationBlocked) const
+const FLyraAbilityTagRelationship& ULyraAbilityTagRelationshipMapping::FindOrCompileRelationship(const FGameplayTag& AbilityTag) const
 {
-	// Simple iteration for now
-	for (int32 i = 0; i < AbilityTagRelationships.Num(); i++)
+	if (const FLyraAbilityTagRelationship* Found = CompiledRelationships.Find(AbilityTag))
 	{
-		const FLyraAbilityTagRelationship& Tags = AbilityTagRelationships[i];
-		if (AbilityTags.HasTag(Tags.AbilityTag))
+		return *Found;
+	}
+
+	FLyraAbilityTagRelationship& Merged = CompiledRelationships.Add(AbilityTag);
+	Merged.AbilityTag = AbilityTag;
+
+	for (const FLyraAbilityTagRelationship& Tags : AbilityTagRelationships)
+	{
+		// Same as a container holding AbilityTag passing HasTag(Tags.AbilityTag)
+		if (AbilityTag.MatchesTag(Tags.AbilityTag))
 		{
-			if (OutActivationRequired)
-			{
-				OutActivationRequired->AppendTags(Tags.ActivationRequiredTags);
-			}
-			if (OutActivationBlocked)
-			{
-				OutActivationBlocked->AppendTags(Tags.ActivationBlockedTags);
-			}
+			Merged.AbilityTagsToBlock.AppendTags(Tags.AbilityTagsToBlock);
+			Merged.AbilityTagsToCancel.AppendTags(Tags.AbilityTagsToCancel);
+			Merged.ActivationRequiredTags.AppendTags(Tags.ActivationRequiredTags);
+			Merged.ActivationBlockedTags.AppendTags(Tags.ActivationBlockedTags);
 		}
 	}
+
+	return Merged;
 }
 
-bool ULyraAbilityTagRelationshipMapping::IsAbilityCancelledByTag(const FGameplayTagContainer& AbilityTags, const FGameplayTag& ActionTag) const
+void ULyraAbilityTagRelationshipMapping::GetAbilityTagsToBlockAndCancel(const FGameplayTagContainer& AbilityTags, FGameplayTagContainer* OutTagsToBlock, FGameplayTagContainer* OutTagsToCancel) const
 {
-	// Simple iteration for now
-	for (int32 i = 0; i < AbilityTagRelationships.Num(); i++)
+	if (!bRelationshipsCompiled)
 	{
-		const FLyraAbilityTagRelationship& Tags = AbilityTagRelationships[i];
+		CompileRelationships();
+	}
 
-		if (Tags.AbilityTag == ActionTag && Tags.AbilityTagsToCancel.HasAny(AbilityTags))
+	for (const FGameplayTag& AbilityTag : AbilityTags)
+	{
+		const FLyraAbilityTagRelationship& Tags = FindOrCompileRelationship(AbilityTag);
+		if (OutTagsToBlock)
+		{
+			OutTagsToBlock->AppendTags(Tags.AbilityTagsToBlock);
+		}
+		if (OutTagsToCancel)
 		{
-			return true;
+			OutTagsToCancel->AppendTags(Tags.AbilityTagsToCancel);
 		}
 	}
+}
 
-	return false;
+void ULyraAbilityTagRelationshipMapping::GetRequiredAndBlockedActivationTags(const FGameplayTagContainer& AbilityTags, FGameplayTagContainer* OutActivationRequired, FGameplayTagContainer* OutActivationBlocked) const
+{
+	if (!bRelationshipsCompiled)
+	{
+		CompileRelationships();
+	}
+
+	for (const FGameplayTag& AbilityTag : AbilityTags)
+	{
+		const FLyraAbilityTagRelationship& Tags = FindOrCompileRelationship(AbilityTag);
+		if (OutActivationRequired)
+		{
+			OutActivationRequired->AppendTags(Tags.ActivationRequiredTags);
+		}
+		if (OutActivationBlocked)
+		{
+			OutActivationBlocked->AppendTags(Tags.ActivationBlockedTags);
+		}
+	}
 }
 
+bool ULyraAbilityTagRelationshipMapping::IsAbilityCancelledByTag(const FGameplayTagContainer& AbilityTags, const FGameplayTag& ActionTag) const
+{
+	if (!bRelationshipsCompiled)
+	{
+		CompileRelationships();
+	}
+
+	const FGameplayTagContainer* CancelTags = CancelTagsByActionTag.Find(ActionTag);
+	return (CancelTags != nullptr) && CancelTags->HasAny(AbilityTags);
+}
@@ -8,6 +8,7 @@
 #include "LyraAbilityTagRelationshipMapping.generated.h"
 
 class UObject;
+struct FPropertyChangedEvent;
 
 /** Struct that defines the relationship between different ability tags */
 USTRUCT()
@@ -57,4 +58,28 @@ public:
 
 	/** Returns true if the specified ability tags are canceled by the passed in action tag */
 	bool IsAbilityCancelledByTag(const FGameplayTagContainer& AbilityTags, const FGameplayTag& ActionTag) const;
+
+	//~UObject interface
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+	//~End of UObject interface
+
+private:
+	/** Rebuilds the lookup tables from AbilityTagRelationships */
+	void CompileRelationships() const;
+
+	/** Returns every relationship that applies to an ability with this tag merged into one, compiling it on first use */
+	const FLyraAbilityTagRelationship& FindOrCompileRelationship(const FGameplayTag& AbilityTag) const;
+
+private:
+	// Merged relationships keyed by ability tag. Any child of a relationship tag matches it too,
+	// so tags that aren't in AbilityTagRelationships themselves are added the first time they are seen.
+	mutable TMap<FGameplayTag, FLyraAbilityTagRelationship> CompiledRelationships;
+
+	// AbilityTagsToCancel of every relationship, merged by exact relationship tag
+	mutable TMap<FGameplayTag, FGameplayTagContainer> CancelTagsByActionTag;
+
+	mutable bool bRelationshipsCompiled = false;
 };
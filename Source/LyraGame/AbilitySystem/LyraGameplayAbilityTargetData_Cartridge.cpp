@@ -0,0 +1,837 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LyraGameplayAbilityTargetData_Cartridge.h"
+
+#include "Components/PrimitiveComponent.h"
+#include "Engine/HitResult.h"
+#include "Engine/NetSerialization.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "LyraGameplayAbilityTargetData_SingleTargetHit.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+
+#include "Iris/ReplicationState/PropertyNetSerializerInfoRegistry.h"
+#include "Iris/ReplicationState/ReplicationStateDescriptorBuilder.h"
+#include "Iris/Serialization/InternalNetSerializers.h"
+#include "Iris/Serialization/NetBitStreamReader.h"
+#include "Iris/Serialization/NetBitStreamWriter.h"
+#include "Iris/Serialization/NetSerializerArrayStorage.h"
+#include "Iris/Serialization/NetSerializerDelegates.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(LyraGameplayAbilityTargetData_Cartridge)
+
+namespace LyraCartridgeTargetData
+{
+	static bool bSendCompactCartridges = true;
+	static FAutoConsoleVariableRef CVarSendCompactCartridges(
+		TEXT("Lyra.Weapon.SendCompactCartridgeTargetData"),
+		bSendCompactCartridges,
+		TEXT("Should clients pack the bullets of a cartridge into one compact target data entry when sending them to the server"),
+		ECVF_Default);
+
+	// Indices are stored as index + 1 in a byte
+	static constexpr int32 MaxTableEntries = 254;
+	static constexpr int32 MaxBullets = 255;
+
+	// Matches FVector_NetQuantize
+	static constexpr int32 MaxBitsPerOffsetComponent = 20;
+
+	static FVector RoundToWholeUnits(const FVector& Vector)
+	{
+		return FVector(FMath::RoundToDouble(Vector.X), FMath::RoundToDouble(Vector.Y), FMath::RoundToDouble(Vector.Z));
+	}
+
+	template <typename ElementType>
+	static bool FindOrAddIndex(TArray<ElementType>& Table, const ElementType& Value, uint8& OutIndex)
+	{
+		int32 Index = Table.Find(Value);
+		if (Index == INDEX_NONE)
+		{
+			if (Table.Num() >= MaxTableEntries)
+			{
+				return false;
+			}
+			Index = Table.Add(Value);
+		}
+
+		OutIndex = static_cast<uint8>(Index + 1);
+		return true;
+	}
+
+	template <typename ElementType>
+	static bool SerializeTable(FArchive& Ar, TArray<ElementType>& Table)
+	{
+		uint32 Num = Table.Num();
+		Ar.SerializeIntPacked(Num);
+		if (Ar.IsLoading())
+		{
+			if (Num > MaxTableEntries)
+			{
+				Ar.SetError();
+				return false;
+			}
+			Table.SetNum(Num);
+		}
+
+		for (ElementType& Element : Table)
+		{
+			Ar << Element;
+		}
+		return true;
+	}
+
+	// Writes Index + 1 with just enough bits for the table it points into
+	static bool SerializeIndex(FArchive& Ar, uint8& Index, int32 TableNum)
+	{
+		uint32 Value = Index;
+		Ar.SerializeInt(Value, TableNum + 1);
+		if (Ar.IsLoading())
+		{
+			if (Value > static_cast<uint32>(TableNum))
+			{
+				Ar.SetError();
+				return false;
+			}
+			Index = static_cast<uint8>(Value);
+		}
+		return true;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////
+
+FGameplayAbilityTargetDataHandle FLyraGameplayAbilityTargetData_Cartridge::MakeCompactHandle(const FGameplayAbilityTargetDataHandle& InHandle)
+{
+	if (!LyraCartridgeTargetData::bSendCompactCartridges || (InHandle.Num() == 0))
+	{
+		return InHandle;
+	}
+
+	TUniquePtr<FLyraGameplayAbilityTargetData_Cartridge> Cartridge = MakeUnique<FLyraGameplayAbilityTargetData_Cartridge>();
+
+	for (int32 Index = 0; Index < InHandle.Num(); ++Index)
+	{
+		const FGameplayAbilityTargetData* Data = InHandle.Get(Index);
+		if ((Data == nullptr) || (Data->GetScriptStruct() != FLyraGameplayAbilityTargetData_SingleTargetHit::StaticStruct()))
+		{
+			return InHandle;
+		}
+
+		const FLyraGameplayAbilityTargetData_SingleTargetHit* SingleTargetHit = static_cast<const FLyraGameplayAbilityTargetData_SingleTargetHit*>(Data);
+		const FVector BulletTraceStart = LyraCartridgeTargetData::RoundToWholeUnits(SingleTargetHit->HitResult.TraceStart);
+		if (Index == 0)
+		{
+			Cartridge->TraceStart = BulletTraceStart;
+			Cartridge->CartridgeID = SingleTargetHit->CartridgeID;
+		}
+		else if ((SingleTargetHit->CartridgeID != Cartridge->CartridgeID) || !BulletTraceStart.Equals(Cartridge->TraceStart))
+		{
+			// Not all from one cartridge, send them as they are
+			return InHandle;
+		}
+
+		if (!Cartridge->AddBulletHit(SingleTargetHit->HitResult))
+		{
+			return InHandle;
+		}
+	}
+
+	FGameplayAbilityTargetDataHandle CompactHandle(Cartridge.Release());
+	CompactHandle.UniqueId = InHandle.UniqueId;
+	return CompactHandle;
+}
+
+void FLyraGameplayAbilityTargetData_Cartridge::ExpandCartridges(FGameplayAbilityTargetDataHandle& InOutHandle)
+{
+	const bool bHasCartridge = InOutHandle.Data.ContainsByPredicate([](const TSharedPtr<FGameplayAbilityTargetData>& Data)
+		{
+			return Data.IsValid() && (Data->GetScriptStruct() == FLyraGameplayAbilityTargetData_Cartridge::StaticStruct());
+		});
+
+	if (!bHasCartridge)
+	{
+		return;
+	}
+
+	FGameplayAbilityTargetDataHandle ExpandedHandle;
+	ExpandedHandle.UniqueId = InOutHandle.UniqueId;
+
+	for (const TSharedPtr<FGameplayAbilityTargetData>& Data : InOutHandle.Data)
+	{
+		if (Data.IsValid() && (Data->GetScriptStruct() == FLyraGameplayAbilityTargetData_Cartridge::StaticStruct()))
+		{
+			static_cast<const FLyraGameplayAbilityTargetData_Cartridge*>(Data.Get())->AppendSingleTargetHits(ExpandedHandle);
+		}
+		else
+		{
+			ExpandedHandle.Data.Add(Data);
+		}
+	}
+
+	InOutHandle = MoveTemp(ExpandedHandle);
+}
+
+bool FLyraGameplayAbilityTargetData_Cartridge::AddBulletHit(const FHitResult& Hit)
+{
+	using namespace LyraCartridgeTargetData;
+
+	if (Bullets.Num() >= MaxBullets)
+	{
+		return false;
+	}
+
+	FLyraCartridgeBulletHit NewBullet;
+	NewBullet.EndOffset = RoundToWholeUnits(Hit.ImpactPoint - TraceStart);
+	NewBullet.ImpactNormal = Hit.ImpactNormal;
+	NewBullet.bBlockingHit = Hit.bBlockingHit;
+
+	AActor* HitActor = Hit.GetActor();
+	UPrimitiveComponent* HitComponent = Hit.GetComponent();
+	if ((HitActor != nullptr) || (HitComponent != nullptr))
+	{
+		int32 HitObjectIndex = INDEX_NONE;
+		for (int32 Index = 0; Index < HitActors.Num(); ++Index)
+		{
+			if ((HitActors[Index] == HitActor) && (HitComponents[Index] == HitComponent))
+			{
+				HitObjectIndex = Index;
+				break;
+			}
+		}
+
+		if (HitObjectIndex == INDEX_NONE)
+		{
+			if (HitActors.Num() >= MaxTableEntries)
+			{
+				return false;
+			}
+			HitObjectIndex = HitActors.Add(HitActor);
+			HitComponents.Add(HitComponent);
+		}
+
+		NewBullet.HitObjectIndex = static_cast<uint8>(HitObjectIndex + 1);
+	}
+
+	if (!Hit.BoneName.IsNone() && !FindOrAddIndex(BoneNames, Hit.BoneName, NewBullet.BoneNameIndex))
+	{
+		return false;
+	}
+
+	if (Hit.PhysMaterial.IsValid() && !FindOrAddIndex(PhysicalMaterials, Hit.PhysMaterial, NewBullet.PhysicalMaterialIndex))
+	{
+		return false;
+	}
+
+	Bullets.Add(NewBullet);
+	return true;
+}
+
+void FLyraGameplayAbilityTargetData_Cartridge::AppendSingleTargetHits(FGameplayAbilityTargetDataHandle& OutHandle) const
+{
+	for (const FLyraCartridgeBulletHit& Bullet : Bullets)
+	{
+		FLyraGameplayAbilityTargetData_SingleTargetHit* NewTargetData = new FLyraGameplayAbilityTargetData_SingleTargetHit();
+		NewTargetData->CartridgeID = CartridgeID;
+
+		// Location and trace end aren't sent, both are taken to be the impact point
+		const FVector EndPoint = TraceStart + Bullet.EndOffset;
+		FHitResult& Hit = NewTargetData->HitResult;
+		Hit.TraceStart = TraceStart;
+		Hit.TraceEnd = EndPoint;
+		Hit.Location = EndPoint;
+		Hit.ImpactPoint = EndPoint;
+		Hit.Distance = FVector::Dist(TraceStart, EndPoint);
+		Hit.bBlockingHit = Bullet.bBlockingHit;
+		if (Bullet.bBlockingHit)
+		{
+			Hit.Normal = Bullet.ImpactNormal;
+			Hit.ImpactNormal = Bullet.ImpactNormal;
+		}
+
+		if (HitActors.IsValidIndex(Bullet.HitObjectIndex - 1))
+		{
+			Hit.HitObjectHandle = FActorInstanceHandle(HitActors[Bullet.HitObjectIndex - 1].Get());
+			Hit.Component = HitComponents[Bullet.HitObjectIndex - 1];
+		}
+
+		if (BoneNames.IsValidIndex(Bullet.BoneNameIndex - 1))
+		{
+			Hit.BoneName = BoneNames[Bullet.BoneNameIndex - 1];
+		}
+
+		if (PhysicalMaterials.IsValidIndex(Bullet.PhysicalMaterialIndex - 1))
+		{
+			Hit.PhysMaterial = PhysicalMaterials[Bullet.PhysicalMaterialIndex - 1];
+		}
+
+		OutHandle.Add(NewTargetData);
+	}
+}
+
+TArray<TWeakObjectPtr<AActor>> FLyraGameplayAbilityTargetData_Cartridge::GetActors() const
+{
+	TArray<TWeakObjectPtr<AActor>> Result;
+	for (const TWeakObjectPtr<AActor>& HitActor : HitActors)
+	{
+		if (HitActor.IsValid())
+		{
+			Result.AddUnique(HitActor);
+		}
+	}
+	return Result;
+}
+
+bool FLyraGameplayAbilityTargetData_Cartridge::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	using namespace LyraCartridgeTargetData;
+
+	bOutSuccess = true;
+
+	TraceStart.NetSerialize(Ar, Map, bOutSuccess);
+
+	uint32 PackedCartridgeID = static_cast<uint32>(CartridgeID);
+	Ar.SerializeIntPacked(PackedCartridgeID);
+	CartridgeID = static_cast<int32>(PackedCartridgeID);
+
+	// Shared tables, each hit object, bone and physical material is sent once per cartridge
+	uint32 NumHitObjects = HitActors.Num();
+	Ar.SerializeIntPacked(NumHitObjects);
+	if (Ar.IsLoading())
+	{
+		if (NumHitObjects > MaxTableEntries)
+		{
+			Ar.SetError();
+			bOutSuccess = false;
+			return false;
+		}
+		HitActors.SetNum(NumHitObjects);
+		HitComponents.SetNum(NumHitObjects);
+	}
+	for (uint32 Index = 0; Index < NumHitObjects; ++Index)
+	{
+		Ar << HitActors[Index];
+		Ar << HitComponents[Index];
+	}
+
+	if (!SerializeTable(Ar, BoneNames) || !SerializeTable(Ar, PhysicalMaterials))
+	{
+		bOutSuccess = false;
+		return false;
+	}
+
+	uint32 NumBullets = Bullets.Num();
+	Ar.SerializeIntPacked(NumBullets);
+	if (Ar.IsLoading())
+	{
+		if (NumBullets > MaxBullets)
+		{
+			Ar.SetError();
+			bOutSuccess = false;
+			return false;
+		}
+		Bullets.SetNum(NumBullets);
+	}
+
+	// Bullets of a cartridge tend to land close together, so each end point is sent relative to the previous one.
+	// Offsets are whole units, which keeps the running sum exact on both ends.
+	FVector PreviousEndOffset = FVector::ZeroVector;
+	for (FLyraCartridgeBulletHit& Bullet : Bullets)
+	{
+		uint8 bBlockingHit = Bullet.bBlockingHit ? 1 : 0;
+		Ar.SerializeBits(&bBlockingHit, 1);
+		Bullet.bBlockingHit = (bBlockingHit != 0);
+
+		FVector Delta = Bullet.EndOffset - PreviousEndOffset;
+		bOutSuccess &= SerializePackedVector<1, MaxBitsPerOffsetComponent>(Delta, Ar);
+		if (Ar.IsLoading())
+		{
+			Bullet.EndOffset = PreviousEndOffset + Delta;
+		}
+		PreviousEndOffset = Bullet.EndOffset;
+
+		if (Bullet.bBlockingHit)
+		{
+			FVector ImpactNormal = Bullet.ImpactNormal;
+			bOutSuccess &= SerializeFixedVector<1, 8>(ImpactNormal, Ar);
+			Bullet.ImpactNormal = ImpactNormal;
+		}
+
+		if (!SerializeIndex(Ar, Bullet.HitObjectIndex, HitActors.Num())
+			|| !SerializeIndex(Ar, Bullet.BoneNameIndex, BoneNames.Num())
+			|| !SerializeIndex(Ar, Bullet.PhysicalMaterialIndex, PhysicalMaterials.Num()))
+		{
+			bOutSuccess = false;
+			return false;
+		}
+	}
+
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Iris
+
+namespace UE::Net
+{
+
+/**
+ * Mirrors FLyraGameplayAbilityTargetData_Cartridge::NetSerialize for Iris.
+ *
+ * The trace start, cartridge ID and shared tables go through the default struct serializer, which takes care of the
+ * object references. The bullets are quantized here and written with the same delta-encoded end points, 8-bit normals
+ * and variable-width indices as the legacy path.
+ */
+struct FLyraCartridgeTargetDataNetSerializer
+{
+	static const uint32 Version = 0;
+
+	static constexpr bool bHasDynamicState = true;
+	static constexpr bool bHasCustomNetReference = true;
+
+	struct FQuantizedBulletHit
+	{
+		int32 EndOffset[3];
+		uint8 ImpactNormal[3];
+		uint8 HitObjectIndex;
+		uint8 BoneNameIndex;
+		uint8 PhysicalMaterialIndex;
+		uint8 bBlockingHit;
+	};
+
+	// Most cartridges hold a single bullet, only spread weapons need more
+	using FQuantizedBulletArray = Private::FNetSerializerArrayStorage<FQuantizedBulletHit, AllocationPolicies::TInlinedElementAllocationPolicy<1>>;
+
+	struct FQuantizedType
+	{
+		// Quantized state of the replicated properties, its size is checked once the descriptor is built
+		alignas(16) uint8 Properties[192];
+
+		FQuantizedBulletArray Bullets;
+
+		// Table sizes, needed to know the width of the bullet indices
+		uint8 NumHitObjects;
+		uint8 NumBoneNames;
+		uint8 NumPhysicalMaterials;
+	};
+
+	typedef FLyraGameplayAbilityTargetData_Cartridge SourceType;
+	typedef FQuantizedType QuantizedType;
+	typedef FLyraCartridgeTargetDataNetSerializerConfig ConfigType;
+
+	static const ConfigType DefaultConfig;
+
+	static void Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Args);
+	static void Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Args);
+
+	static void Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Args);
+	static void Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Args);
+
+	static bool IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args);
+	static bool Validate(FNetSerializationContext& Context, const FNetValidateArgs& Args);
+
+	static void CloneDynamicState(FNetSerializationContext& Context, const FNetCloneDynamicStateArgs& Args);
+	static void FreeDynamicState(FNetSerializationContext& Context, const FNetFreeDynamicStateArgs& Args);
+
+	static void CollectNetReferences(FNetSerializationContext& Context, const FNetCollectReferencesArgs& Args);
+
+private:
+	class FNetSerializerRegistryDelegates final : private UE::Net::FNetSerializerRegistryDelegates
+	{
+	public:
+		virtual ~FNetSerializerRegistryDelegates();
+
+	private:
+		virtual void OnPreFreezeNetSerializerRegistry() override;
+		virtual void OnPostFreezeNetSerializerRegistry() override;
+	};
+
+	// Bits needed for an index + 1 into a table with TableNum entries, matches FArchive::SerializeInt(Value, TableNum + 1)
+	static uint32 GetIndexBits(uint32 TableNum) { return FMath::CeilLogTwo(TableNum + 1); }
+
+	static uint8 QuantizeNormalComponent(double Value);
+	static double DequantizeNormalComponent(uint8 Value);
+
+	static bool IsBulletEqual(const FQuantizedBulletHit& A, const FQuantizedBulletHit& B);
+	static bool IsBulletEqual(const FLyraCartridgeBulletHit& A, const FLyraCartridgeBulletHit& B);
+
+	template <typename ArgsType>
+	static ArgsType MakePropertiesArgs(const ArgsType& Args)
+	{
+		ArgsType PropertiesArgs = Args;
+		PropertiesArgs.NetSerializerConfig = NetSerializerConfigParam(&StructNetSerializerConfig);
+		return PropertiesArgs;
+	}
+
+	static FNetSerializerRegistryDelegates NetSerializerRegistryDelegates;
+	static FStructNetSerializerConfig StructNetSerializerConfig;
+	static const FNetSerializer* StructNetSerializer;
+};
+
+UE_NET_DECLARE_SERIALIZER(FLyraCartridgeTargetDataNetSerializer, LYRAGAME_API);
+UE_NET_IMPLEMENT_SERIALIZER(FLyraCartridgeTargetDataNetSerializer);
+
+static const FName PropertyNetSerializerRegistry_NAME_LyraGameplayAbilityTargetData_Cartridge("LyraGameplayAbilityTargetData_Cartridge");
+UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_LyraGameplayAbilityTargetData_Cartridge, FLyraCartridgeTargetDataNetSerializer);
+
+const FLyraCartridgeTargetDataNetSerializer::ConfigType FLyraCartridgeTargetDataNetSerializer::DefaultConfig;
+FLyraCartridgeTargetDataNetSerializer::FNetSerializerRegistryDelegates FLyraCartridgeTargetDataNetSerializer::NetSerializerRegistryDelegates;
+FStructNetSerializerConfig FLyraCartridgeTargetDataNetSerializer::StructNetSerializerConfig;
+const FNetSerializer* FLyraCartridgeTargetDataNetSerializer::StructNetSerializer = &UE_NET_GET_SERIALIZER(FStructNetSerializer);
+
+void FLyraCartridgeTargetDataNetSerializer::Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Args)
+{
+	const QuantizedType& Value = *reinterpret_cast<const QuantizedType*>(Args.Source);
+
+	FNetSerializeArgs PropertiesArgs = MakePropertiesArgs(Args);
+	PropertiesArgs.Source = NetSerializerValuePointer(&Value.Properties);
+	StructNetSerializer->Serialize(Context, PropertiesArgs);
+
+	FNetBitStreamWriter* Writer = Context.GetBitStreamWriter();
+	Writer->WriteBits(Value.NumHitObjects, 8U);
+	Writer->WriteBits(Value.NumBoneNames, 8U);
+	Writer->WriteBits(Value.NumPhysicalMaterials, 8U);
+
+	const uint32 HitObjectIndexBits = GetIndexBits(Value.NumHitObjects);
+	const uint32 BoneNameIndexBits = GetIndexBits(Value.NumBoneNames);
+	const uint32 PhysicalMaterialIndexBits = GetIndexBits(Value.NumPhysicalMaterials);
+
+	const uint32 NumBullets = Value.Bullets.Num();
+	Writer->WriteBits(NumBullets, 8U);
+
+	// Each end point is sent relative to the previous one, zigzag encoded with as many bits as its largest component needs
+	int32 PreviousEndOffset[3] = {};
+	for (const FQuantizedBulletHit& Bullet : MakeArrayView(Value.Bullets.GetData(), static_cast<int32>(NumBullets)))
+	{
+		Writer->WriteBool(Bullet.bBlockingHit != 0);
+
+		uint32 ZigZagDelta[3];
+		uint32 NumDeltaBits = 0;
+		for (int32 Component = 0; Component < 3; ++Component)
+		{
+			const int32 Delta = Bullet.EndOffset[Component] - PreviousEndOffset[Component];
+			ZigZagDelta[Component] = (static_cast<uint32>(Delta) << 1U) ^ static_cast<uint32>(Delta >> 31);
+			NumDeltaBits = FMath::Max(NumDeltaBits, 32U - FMath::CountLeadingZeros(ZigZagDelta[Component]));
+			PreviousEndOffset[Component] = Bullet.EndOffset[Component];
+		}
+
+		Writer->WriteBits(NumDeltaBits, 5U);
+		if (NumDeltaBits > 0)
+		{
+			for (int32 Component = 0; Component < 3; ++Component)
+			{
+				Writer->WriteBits(ZigZagDelta[Component], NumDeltaBits);
+			}
+		}
+
+		if (Bullet.bBlockingHit)
+		{
+			for (int32 Component = 0; Component < 3; ++Component)
+			{
+				Writer->WriteBits(Bullet.ImpactNormal[Component], 8U);
+			}
+		}
+
+		if (HitObjectIndexBits > 0)
+		{
+			Writer->WriteBits(Bullet.HitObjectIndex, HitObjectIndexBits);
+		}
+		if (BoneNameIndexBits > 0)
+		{
+			Writer->WriteBits(Bullet.BoneNameIndex, BoneNameIndexBits);
+		}
+		if (PhysicalMaterialIndexBits > 0)
+		{
+			Writer->WriteBits(Bullet.PhysicalMaterialIndex, PhysicalMaterialIndexBits);
+		}
+	}
+}
+
+void FLyraCartridgeTargetDataNetSerializer::Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Args)
+{
+	QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+
+	FNetDeserializeArgs PropertiesArgs = MakePropertiesArgs(Args);
+	PropertiesArgs.Target = NetSerializerValuePointer(&Target.Properties);
+	StructNetSerializer->Deserialize(Context, PropertiesArgs);
+
+	FNetBitStreamReader* Reader = Context.GetBitStreamReader();
+	Target.NumHitObjects = static_cast<uint8>(Reader->ReadBits(8U));
+	Target.NumBoneNames = static_cast<uint8>(Reader->ReadBits(8U));
+	Target.NumPhysicalMaterials = static_cast<uint8>(Reader->ReadBits(8U));
+
+	const uint32 HitObjectIndexBits = GetIndexBits(Target.NumHitObjects);
+	const uint32 BoneNameIndexBits = GetIndexBits(Target.NumBoneNames);
+	const uint32 PhysicalMaterialIndexBits = GetIndexBits(Target.NumPhysicalMaterials);
+
+	const uint32 NumBullets = Reader->ReadBits(8U);
+	Target.Bullets.AdjustSize(Context, NumBullets);
+
+	int32 PreviousEndOffset[3] = {};
+	for (FQuantizedBulletHit& Bullet : MakeArrayView(Target.Bullets.GetData(), static_cast<int32>(NumBullets)))
+	{
+		FMemory::Memzero(Bullet);
+		Bullet.bBlockingHit = Reader->ReadBool() ? 1 : 0;
+
+		const uint32 NumDeltaBits = Reader->ReadBits(5U);
+		for (int32 Component = 0; Component < 3; ++Component)
+		{
+			const uint32 ZigZagDelta = (NumDeltaBits > 0) ? Reader->ReadBits(NumDeltaBits) : 0U;
+			const int32 Delta = static_cast<int32>(ZigZagDelta >> 1U) ^ -static_cast<int32>(ZigZagDelta & 1U);
+			Bullet.EndOffset[Component] = PreviousEndOffset[Component] + Delta;
+			PreviousEndOffset[Component] = Bullet.EndOffset[Component];
+		}
+
+		if (Bullet.bBlockingHit)
+		{
+			for (int32 Component = 0; Component < 3; ++Component)
+			{
+				Bullet.ImpactNormal[Component] = static_cast<uint8>(Reader->ReadBits(8U));
+			}
+		}
+
+		Bullet.HitObjectIndex = static_cast<uint8>((HitObjectIndexBits > 0) ? Reader->ReadBits(HitObjectIndexBits) : 0U);
+		Bullet.BoneNameIndex = static_cast<uint8>((BoneNameIndexBits > 0) ? Reader->ReadBits(BoneNameIndexBits) : 0U);
+		Bullet.PhysicalMaterialIndex = static_cast<uint8>((PhysicalMaterialIndexBits > 0) ? Reader->ReadBits(PhysicalMaterialIndexBits) : 0U);
+
+		if ((Bullet.HitObjectIndex > Target.NumHitObjects) || (Bullet.BoneNameIndex > Target.NumBoneNames) || (Bullet.PhysicalMaterialIndex > Target.NumPhysicalMaterials))
+		{
+			Context.SetError(GNetError_InvalidValue);
+			return;
+		}
+	}
+}
+
+void FLyraCartridgeTargetDataNetSerializer::Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Args)
+{
+	using namespace LyraCartridgeTargetData;
+
+	const SourceType& Source = *reinterpret_cast<const SourceType*>(Args.Source);
+	QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+
+	FNetQuantizeArgs PropertiesArgs = MakePropertiesArgs(Args);
+	PropertiesArgs.Target = NetSerializerValuePointer(&Target.Properties);
+	StructNetSerializer->Quantize(Context, PropertiesArgs);
+
+	Target.NumHitObjects = static_cast<uint8>(FMath::Min(Source.HitActors.Num(), MaxTableEntries));
+	Target.NumBoneNames = static_cast<uint8>(FMath::Min(Source.BoneNames.Num(), MaxTableEntries));
+	Target.NumPhysicalMaterials = static_cast<uint8>(FMath::Min(Source.PhysicalMaterials.Num(), MaxTableEntries));
+
+	const int32 NumBullets = FMath::Min(Source.Bullets.Num(), MaxBullets);
+	Target.Bullets.AdjustSize(Context, NumBullets);
+
+	// Bounds the zigzag encoded deltas to 22 bits, so their bit count always fits in 5 bits
+	const double MaxOffset = static_cast<double>(1 << MaxBitsPerOffsetComponent);
+	for (int32 BulletIndex = 0; BulletIndex < NumBullets; ++BulletIndex)
+	{
+		const FLyraCartridgeBulletHit& Bullet = Source.Bullets[BulletIndex];
+		FQuantizedBulletHit& QuantizedBullet = Target.Bullets.GetData()[BulletIndex];
+		FMemory::Memzero(QuantizedBullet);
+
+		for (int32 Component = 0; Component < 3; ++Component)
+		{
+			QuantizedBullet.EndOffset[Component] = static_cast<int32>(FMath::RoundToDouble(FMath::Clamp(Bullet.EndOffset[Component], -MaxOffset, MaxOffset)));
+			if (Bullet.bBlockingHit)
+			{
+				QuantizedBullet.ImpactNormal[Component] = QuantizeNormalComponent(Bullet.ImpactNormal[Component]);
+			}
+		}
+
+		QuantizedBullet.HitObjectIndex = Bullet.HitObjectIndex;
+		QuantizedBullet.BoneNameIndex = Bullet.BoneNameIndex;
+		QuantizedBullet.PhysicalMaterialIndex = Bullet.PhysicalMaterialIndex;
+		QuantizedBullet.bBlockingHit = Bullet.bBlockingHit ? 1 : 0;
+	}
+}
+
+void FLyraCartridgeTargetDataNetSerializer::Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Args)
+{
+	const QuantizedType& Source = *reinterpret_cast<const QuantizedType*>(Args.Source);
+	SourceType& Target = *reinterpret_cast<SourceType*>(Args.Target);
+
+	FNetDequantizeArgs PropertiesArgs = MakePropertiesArgs(Args);
+	PropertiesArgs.Source = NetSerializerValuePointer(&Source.Properties);
+	StructNetSerializer->Dequantize(Context, PropertiesArgs);
+
+	const uint32 NumBullets = Source.Bullets.Num();
+	Target.Bullets.SetNum(NumBullets);
+	for (uint32 BulletIndex = 0; BulletIndex < NumBullets; ++BulletIndex)
+	{
+		const FQuantizedBulletHit& QuantizedBullet = Source.Bullets.GetData()[BulletIndex];
+		FLyraCartridgeBulletHit& Bullet = Target.Bullets[BulletIndex];
+
+		Bullet.EndOffset = FVector(QuantizedBullet.EndOffset[0], QuantizedBullet.EndOffset[1], QuantizedBullet.EndOffset[2]);
+		Bullet.bBlockingHit = (QuantizedBullet.bBlockingHit != 0);
+		Bullet.ImpactNormal = Bullet.bBlockingHit
+			? FVector(DequantizeNormalComponent(QuantizedBullet.ImpactNormal[0]), DequantizeNormalComponent(QuantizedBullet.ImpactNormal[1]), DequantizeNormalComponent(QuantizedBullet.ImpactNormal[2]))
+			: FVector::ZeroVector;
+		Bullet.HitObjectIndex = QuantizedBullet.HitObjectIndex;
+		Bullet.BoneNameIndex = QuantizedBullet.BoneNameIndex;
+		Bullet.PhysicalMaterialIndex = QuantizedBullet.PhysicalMaterialIndex;
+	}
+}
+
+bool FLyraCartridgeTargetDataNetSerializer::IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args)
+{
+	if (Args.bStateIsQuantized)
+	{
+		const QuantizedType& Value0 = *reinterpret_cast<const QuantizedType*>(Args.Source0);
+		const QuantizedType& Value1 = *reinterpret_cast<const QuantizedType*>(Args.Source1);
+
+		if ((Value0.NumHitObjects != Value1.NumHitObjects)
+			|| (Value0.NumBoneNames != Value1.NumBoneNames)
+			|| (Value0.NumPhysicalMaterials != Value1.NumPhysicalMaterials)
+			|| (Value0.Bullets.Num() != Value1.Bullets.Num()))
+		{
+			return false;
+		}
+
+		for (uint32 BulletIndex = 0; BulletIndex < Value0.Bullets.Num(); ++BulletIndex)
+		{
+			if (!IsBulletEqual(Value0.Bullets.GetData()[BulletIndex], Value1.Bullets.GetData()[BulletIndex]))
+			{
+				return false;
+			}
+		}
+
+		FNetIsEqualArgs PropertiesArgs = MakePropertiesArgs(Args);
+		PropertiesArgs.Source0 = NetSerializerValuePointer(&Value0.Properties);
+		PropertiesArgs.Source1 = NetSerializerValuePointer(&Value1.Properties);
+		return StructNetSerializer->IsEqual(Context, PropertiesArgs);
+	}
+
+	const SourceType& Value0 = *reinterpret_cast<const SourceType*>(Args.Source0);
+	const SourceType& Value1 = *reinterpret_cast<const SourceType*>(Args.Source1);
+
+	if (Value0.Bullets.Num() != Value1.Bullets.Num())
+	{
+		return false;
+	}
+
+	for (int32 BulletIndex = 0; BulletIndex < Value0.Bullets.Num(); ++BulletIndex)
+	{
+		if (!IsBulletEqual(Value0.Bullets[BulletIndex], Value1.Bullets[BulletIndex]))
+		{
+			return false;
+		}
+	}
+
+	return StructNetSerializer->IsEqual(Context, MakePropertiesArgs(Args));
+}
+
+bool FLyraCartridgeTargetDataNetSerializer::Validate(FNetSerializationContext& Context, const FNetValidateArgs& Args)
+{
+	using namespace LyraCartridgeTargetData;
+
+	const SourceType& Source = *reinterpret_cast<const SourceType*>(Args.Source);
+
+	if ((Source.Bullets.Num() > MaxBullets)
+		|| (Source.HitActors.Num() > MaxTableEntries)
+		|| (Source.HitComponents.Num() != Source.HitActors.Num())
+		|| (Source.BoneNames.Num() > MaxTableEntries)
+		|| (Source.PhysicalMaterials.Num() > MaxTableEntries))
+	{
+		return false;
+	}
+
+	for (const FLyraCartridgeBulletHit& Bullet : Source.Bullets)
+	{
+		if ((Bullet.HitObjectIndex > Source.HitActors.Num())
+			|| (Bullet.BoneNameIndex > Source.BoneNames.Num())
+			|| (Bullet.PhysicalMaterialIndex > Source.PhysicalMaterials.Num()))
+		{
+			return false;
+		}
+	}
+
+	return StructNetSerializer->Validate(Context, MakePropertiesArgs(Args));
+}
+
+void FLyraCartridgeTargetDataNetSerializer::CloneDynamicState(FNetSerializationContext& Context, const FNetCloneDynamicStateArgs& Args)
+{
+	const QuantizedType& Source = *reinterpret_cast<const QuantizedType*>(Args.Source);
+	QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+
+	FNetCloneDynamicStateArgs PropertiesArgs = MakePropertiesArgs(Args);
+	PropertiesArgs.Source = NetSerializerValuePointer(&Source.Properties);
+	PropertiesArgs.Target = NetSerializerValuePointer(&Target.Properties);
+	StructNetSerializer->CloneDynamicState(Context, PropertiesArgs);
+
+	Target.Bullets.Clone(Context, Source.Bullets);
+}
+
+void FLyraCartridgeTargetDataNetSerializer::FreeDynamicState(FNetSerializationContext& Context, const FNetFreeDynamicStateArgs& Args)
+{
+	QuantizedType& Source = *reinterpret_cast<QuantizedType*>(Args.Source);
+
+	FNetFreeDynamicStateArgs PropertiesArgs = MakePropertiesArgs(Args);
+	PropertiesArgs.Source = NetSerializerValuePointer(&Source.Properties);
+	StructNetSerializer->FreeDynamicState(Context, PropertiesArgs);
+
+	Source.Bullets.Free(Context);
+}
+
+void FLyraCartridgeTargetDataNetSerializer::CollectNetReferences(FNetSerializationContext& Context, const FNetCollectReferencesArgs& Args)
+{
+	const QuantizedType& Source = *reinterpret_cast<const QuantizedType*>(Args.Source);
+
+	// Only the shared tables reference objects
+	FNetCollectReferencesArgs PropertiesArgs = MakePropertiesArgs(Args);
+	PropertiesArgs.Source = NetSerializerValuePointer(&Source.Properties);
+	StructNetSerializer->CollectNetReferences(Context, PropertiesArgs);
+}
+
+uint8 FLyraCartridgeTargetDataNetSerializer::QuantizeNormalComponent(double Value)
+{
+	return static_cast<uint8>(FMath::RoundToInt32((FMath::Clamp(Value, -1.0, 1.0) + 1.0) * 127.5));
+}
+
+double FLyraCartridgeTargetDataNetSerializer::DequantizeNormalComponent(uint8 Value)
+{
+	return (static_cast<double>(Value) / 127.5) - 1.0;
+}
+
+bool FLyraCartridgeTargetDataNetSerializer::IsBulletEqual(const FQuantizedBulletHit& A, const FQuantizedBulletHit& B)
+{
+	return (A.EndOffset[0] == B.EndOffset[0]) && (A.EndOffset[1] == B.EndOffset[1]) && (A.EndOffset[2] == B.EndOffset[2])
+		&& (A.ImpactNormal[0] == B.ImpactNormal[0]) && (A.ImpactNormal[1] == B.ImpactNormal[1]) && (A.ImpactNormal[2] == B.ImpactNormal[2])
+		&& (A.HitObjectIndex == B.HitObjectIndex)
+		&& (A.BoneNameIndex == B.BoneNameIndex)
+		&& (A.PhysicalMaterialIndex == B.PhysicalMaterialIndex)
+		&& (A.bBlockingHit == B.bBlockingHit);
+}
+
+bool FLyraCartridgeTargetDataNetSerializer::IsBulletEqual(const FLyraCartridgeBulletHit& A, const FLyraCartridgeBulletHit& B)
+{
+	return A.EndOffset.Equals(B.EndOffset, 0.0)
+		&& A.ImpactNormal.Equals(B.ImpactNormal, 0.0)
+		&& (A.HitObjectIndex == B.HitObjectIndex)
+		&& (A.BoneNameIndex == B.BoneNameIndex)
+		&& (A.PhysicalMaterialIndex == B.PhysicalMaterialIndex)
+		&& (A.bBlockingHit == B.bBlockingHit);
+}
+
+FLyraCartridgeTargetDataNetSerializer::FNetSerializerRegistryDelegates::~FNetSerializerRegistryDelegates()
+{
+	UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_LyraGameplayAbilityTargetData_Cartridge);
+}
+
+void FLyraCartridgeTargetDataNetSerializer::FNetSerializerRegistryDelegates::OnPreFreezeNetSerializerRegistry()
+{
+	UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_LyraGameplayAbilityTargetData_Cartridge);
+}
+
+void FLyraCartridgeTargetDataNetSerializer::FNetSerializerRegistryDelegates::OnPostFreezeNetSerializerRegistry()
+{
+	// Describe the replicated properties without picking this serializer up again
+	FReplicationStateDescriptorBuilder::FParameters Params;
+	Params.SkipCheckForCustomNetSerializerForStruct = true;
+	StructNetSerializerConfig.StateDescriptor = FReplicationStateDescriptorBuilder::CreateDescriptorForStruct(FLyraGameplayAbilityTargetData_Cartridge::StaticStruct(), Params);
+
+	const FReplicationStateDescriptor* Descriptor = StructNetSerializerConfig.StateDescriptor.GetReference();
+	check(Descriptor != nullptr);
+	checkf((Descriptor->InternalSize <= sizeof(FQuantizedType::Properties)) && (Descriptor->InternalAlignment <= alignof(FQuantizedType)),
+		TEXT("FLyraCartridgeTargetDataNetSerializer::FQuantizedType::Properties needs %u bytes with %u alignment to fit FLyraGameplayAbilityTargetData_Cartridge."),
+		uint32(Descriptor->InternalSize), uint32(Descriptor->InternalAlignment));
+}
+
+}
@@ -0,0 +1,121 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Abilities/GameplayAbilityTargetTypes.h"
+#include "Iris/Serialization/NetSerializerConfig.h"
+
+#include "LyraGameplayAbilityTargetData_Cartridge.generated.h"
+
+class AActor;
+class FArchive;
+class UPackageMap;
+class UPhysicalMaterial;
+class UPrimitiveComponent;
+struct FHitResult;
+
+/** A single bullet of a cartridge, referencing the shared tables of its FLyraGameplayAbilityTargetData_Cartridge */
+USTRUCT()
+struct FLyraCartridgeBulletHit
+{
+	GENERATED_BODY()
+
+	/** Impact point (or trace end when nothing was hit) relative to the cartridge trace start, in whole units */
+	UPROPERTY()
+	FVector_NetQuantize EndOffset = FVector::ZeroVector;
+
+	/** Only meaningful for blocking hits */
+	UPROPERTY()
+	FVector_NetQuantizeNormal ImpactNormal = FVector::ZeroVector;
+
+	/** Index + 1 into HitActors and HitComponents, 0 if nothing was hit */
+	UPROPERTY()
+	uint8 HitObjectIndex = 0;
+
+	/** Index + 1 into BoneNames, 0 for no bone */
+	UPROPERTY()
+	uint8 BoneNameIndex = 0;
+
+	/** Index + 1 into PhysicalMaterials, 0 for no physical material */
+	UPROPERTY()
+	uint8 PhysicalMaterialIndex = 0;
+
+	UPROPERTY()
+	bool bBlockingHit = false;
+};
+
+/**
+ * All bullets of one cartridge in a single target data entry, only used to send them to the server
+ *
+ * The trace start is shared, each bullet stores where it ended relative to it, and hit objects, bone names and physical
+ * materials are stored once per cartridge and referenced by index. NetSerialize additionally delta-encodes the bullet
+ * end points against each other and bit-packs the indices, FLyraCartridgeTargetDataNetSerializer does the same for Iris.
+ * The receiving end expands it back into one FLyraGameplayAbilityTargetData_SingleTargetHit per bullet.
+ */
+USTRUCT()
+struct FLyraGameplayAbilityTargetData_Cartridge : public FGameplayAbilityTargetData
+{
+	GENERATED_BODY()
+
+	/** Returns a handle with the bullets of InHandle packed into one cartridge entry, or InHandle itself if they can't be packed */
+	static FGameplayAbilityTargetDataHandle MakeCompactHandle(const FGameplayAbilityTargetDataHandle& InHandle);
+
+	/** Replaces every cartridge entry of the handle with the single target hits it was made from */
+	static void ExpandCartridges(FGameplayAbilityTargetDataHandle& InOutHandle);
+
+	/** Adds a bullet hit to the cartridge, returns false if it doesn't fit */
+	bool AddBulletHit(const FHitResult& Hit);
+
+	/** Adds one FLyraGameplayAbilityTargetData_SingleTargetHit per bullet to the handle */
+	void AppendSingleTargetHits(FGameplayAbilityTargetDataHandle& OutHandle) const;
+
+	virtual TArray<TWeakObjectPtr<AActor>> GetActors() const override;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+
+	virtual UScriptStruct* GetScriptStruct() const override
+	{
+		return FLyraGameplayAbilityTargetData_Cartridge::StaticStruct();
+	}
+
+public:
+	/** Where every bullet of the cartridge was traced from, in whole units */
+	UPROPERTY()
+	FVector_NetQuantize TraceStart = FVector::ZeroVector;
+
+	/** ID to allow the identification of multiple bullets that were part of the same cartridge */
+	UPROPERTY()
+	int32 CartridgeID = -1;
+
+	/** Packed by hand by both serializers, so it is left out of the Iris replication state of the other properties */
+	UPROPERTY(NotReplicated)
+	TArray<FLyraCartridgeBulletHit> Bullets;
+
+	/** Hit actors, paired with HitComponents */
+	UPROPERTY()
+	TArray<TWeakObjectPtr<AActor>> HitActors;
+
+	UPROPERTY()
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> HitComponents;
+
+	UPROPERTY()
+	TArray<FName> BoneNames;
+
+	UPROPERTY()
+	TArray<TWeakObjectPtr<UPhysicalMaterial>> PhysicalMaterials;
+};
+
+template<>
+struct TStructOpsTypeTraits<FLyraGameplayAbilityTargetData_Cartridge> : public TStructOpsTypeTraitsBase2<FLyraGameplayAbilityTargetData_Cartridge>
+{
+	enum
+	{
+		WithNetSerializer = true	// For now this is REQUIRED for FGameplayAbilityTargetDataHandle net serialization to work
+	};
+};
+
+USTRUCT()
+struct FLyraCartridgeTargetDataNetSerializerConfig : public FNetSerializerConfig
+{
+	GENERATED_BODY()
+};
@@ -89,6 +89,8 @@ void ULyraGameplayCueManager::LoadAlwaysLoadedCues()
 				UE_LOG(LogLyra, Warning, TEXT("ULyraGameplayCueManager::AdditionalAlwaysLoadedCueTags contains invalid tag %s"), *CueTagName.ToString());
 			}
 		}
+
+		StreamPendingPreloads();
 	}
 }
 
@@ -123,6 +125,15 @@ bool ULyraGameplayCueManager::ShouldAsyncLoadMissingGameplayCues() const
 	return true;
 }
 
+bool ULyraGameplayCueManager::HandleMissingGameplayCue(UGameplayCueSet* OwningSet, struct FGameplayCueNotifyData& CueData, AActor* TargetActor, EGameplayCueEvent::Type EventType, FGameplayCueParameters& Parameters)
+{
+	// The cue was invoked before preloading got to it, which usually means it will play late or not at all this time
+	++NumCueMissesThisMap;
+	UE_LOG(LogLyra, Verbose, TEXT("Gameplay cue %s was invoked before it was loaded (%d misses this map)"), *CueData.GameplayCueNotifyObj.ToString(), NumCueMissesThisMap);
+
+	return Super::HandleMissingGameplayCue(OwningSet, CueData, TargetActor, EventType, Parameters);
+}
+
 void ULyraGameplayCueManager::DumpGameplayCues(const TArray<FString>& Args)
 {
 	ULyraGameplayCueManager* GCM = Cast<ULyraGameplayCueManager>(UAbilitySystemGlobals::Get().GetGameplayCueManager());
@@ -143,12 +154,12 @@ void ULyraGameplayCueManager::DumpGameplayCues(const TArray<FString>& Args)
 	UE_LOG(LogLyra, Log, TEXT("=========== Dumping Preloaded Gameplay Cue Notifies ==========="));
 	for (UClass* CueClass : GCM->PreloadedCues)
 	{
-		TSet<FObjectKey>* ReferencerSet = GCM->PreloadedCueReferencers.Find(CueClass);
-		int32 NumRefs = ReferencerSet ? ReferencerSet->Num() : 0;
+		TArray<FObjectKey>* Referencers = GCM->PreloadedCueReferencers.Find(CueClass);
+		int32 NumRefs = Referencers ? Referencers->Num() : 0;
 		UE_LOG(LogLyra, Log, TEXT("  %s (%d refs)"), *GetPathNameSafe(CueClass), NumRefs);
-		if (bIncludeRefs && ReferencerSet)
+		if (bIncludeRefs && Referencers)
 		{
-			for (const FObjectKey& Ref : *ReferencerSet)
+			for (const FObjectKey& Ref : *Referencers)
 			{
 				UObject* RefObject = Ref.ResolveObjectPtr();
 				UE_LOG(LogLyra, Log, TEXT("    ^- %s"), *GetPathNameSafe(RefObject));
@@ -175,6 +186,7 @@ void ULyraGameplayCueManager::DumpGameplayCues(const TArray<FString>& Args)
 	UE_LOG(LogLyra, Log, TEXT("  ... %d cues in preloaded list"), GCM->PreloadedCues.Num());
 	UE_LOG(LogLyra, Log, TEXT("  ... %d cues loaded on demand"), NumMissingCuesLoaded);
 	UE_LOG(LogLyra, Log, TEXT("  ... %d cues in total"), GCM->AlwaysLoadedCues.Num() + GCM->PreloadedCues.Num() + NumMissingCuesLoaded);
+	UE_LOG(LogLyra, Log, TEXT("  ... %d cues invoked before they were loaded since the last map load"), GCM->NumCueMissesThisMap);
 }
 
 void ULyraGameplayCueManager::OnGameplayTagLoaded(const FGameplayTag& Tag)
@@ -241,6 +253,8 @@ void ULyraGameplayCueManager::ProcessLoadedTags()
 					}
 				}
 			}
+
+			StreamPendingPreloads();
 		}
 		else
 		{
@@ -281,20 +295,62 @@ void ULyraGameplayCueManager::ProcessTagToPreload(const FGameplayTag& Tag, UObje
 		}
 		else
 		{
-			bool bAlwaysLoadedCue = OwningObject == nullptr;
-			TWeakObjectPtr<UObject> WeakOwner = OwningObject;
-			StreamableManager.RequestAsyncLoad(CueData.GameplayCueNotifyObj, FStreamableDelegate::CreateUObject(this, &ThisClass::OnPreloadCueComplete, CueData.GameplayCueNotifyObj, WeakOwner, bAlwaysLoadedCue), FStreamableManager::DefaultAsyncLoadPriority, false, false, TEXT("GameplayCueManager"));
+			// Requested together with the other cues found in the same pass by StreamPendingPreloads
+			FPendingPreloadCue& PendingCue = PendingPreloadCues.AddDefaulted_GetRef();
+			PendingCue.Path = CueData.GameplayCueNotifyObj;
+			PendingCue.WeakOwner = OwningObject;
+			PendingCue.bAlwaysLoadedCue = (OwningObject == nullptr);
 		}
 	}
 }
 
-void ULyraGameplayCueManager::OnPreloadCueComplete(FSoftObjectPath Path, TWeakObjectPtr<UObject> OwningObject, bool bAlwaysLoadedCue)
+void ULyraGameplayCueManager::StreamPendingPreloads()
+{
+	if (PendingPreloadCues.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> PathsToLoad;
+	PathsToLoad.Reserve(PendingPreloadCues.Num());
+	bool bHasAlwaysLoadedCue = false;
+	for (const FPendingPreloadCue& PendingCue : PendingPreloadCues)
+	{
+		PathsToLoad.AddUnique(PendingCue.Path);
+		bHasAlwaysLoadedCue |= PendingCue.bAlwaysLoadedCue;
+	}
+
+	const int32 BatchId = NextPreloadBatchId++;
+	PreloadBatches.Add(BatchId).Cues = MoveTemp(PendingPreloadCues);
+	PendingPreloadCues.Reset();
+
+	// Always loaded cues can be needed at any moment, so they are streamed ahead of content referenced ones
+	const TAsyncLoadPriority Priority = bHasAlwaysLoadedCue ? FStreamableManager::AsyncLoadHighPriority : FStreamableManager::DefaultAsyncLoadPriority;
+	TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(MoveTemp(PathsToLoad), FStreamableDelegate::CreateUObject(this, &ThisClass::OnPreloadCuesComplete, BatchId), Priority, false, false, TEXT("GameplayCueManager"));
+
+	// The batch is already gone if everything was in memory and the callback ran right away
+	if (FPreloadBatch* Batch = PreloadBatches.Find(BatchId))
+	{
+		Batch->Handle = Handle;
+	}
+}
+
+void ULyraGameplayCueManager::OnPreloadCuesComplete(int32 BatchId)
 {
-	if (bAlwaysLoadedCue || OwningObject.IsValid())
+	FPreloadBatch Batch;
+	if (!PreloadBatches.RemoveAndCopyValue(BatchId, Batch))
 	{
-		if (UClass* LoadedGameplayCueClass = Cast<UClass>(Path.ResolveObject()))
+		return;
+	}
+
+	for (const FPendingPreloadCue& PendingCue : Batch.Cues)
+	{
+		if (PendingCue.bAlwaysLoadedCue || PendingCue.WeakOwner.IsValid())
 		{
-			RegisterPreloadedCue(LoadedGameplayCueClass, OwningObject.Get());
+			if (UClass* LoadedGameplayCueClass = Cast<UClass>(PendingCue.Path.ResolveObject()))
+			{
+				RegisterPreloadedCue(LoadedGameplayCueClass, PendingCue.WeakOwner.Get());
+			}
 		}
 	}
 }
@@ -313,8 +369,8 @@ void ULyraGameplayCueManager::RegisterPreloadedCue(UClass* LoadedGameplayCueClas
 	else if ((OwningObject != LoadedGameplayCueClass) && (OwningObject != LoadedGameplayCueClass->GetDefaultObject()) && !AlwaysLoadedCues.Contains(LoadedGameplayCueClass))
 	{
 		PreloadedCues.Add(LoadedGameplayCueClass);
-		TSet<FObjectKey>& ReferencerSet = PreloadedCueReferencers.FindOrAdd(LoadedGameplayCueClass);
-		ReferencerSet.Add(OwningObject);
+		TArray<FObjectKey>& Referencers = PreloadedCueReferencers.FindOrAdd(LoadedGameplayCueClass);
+		Referencers.AddUnique(OwningObject);
 	}
 }
 
@@ -335,20 +391,24 @@ void ULyraGameplayCueManager::HandlePostLoadMap(UWorld* NewWorld)
 
 	for (auto CueIt = PreloadedCues.CreateIterator(); CueIt; ++CueIt)
 	{
-		TSet<FObjectKey>& ReferencerSet = PreloadedCueReferencers.FindChecked(*CueIt);
-		for (auto RefIt = ReferencerSet.CreateIterator(); RefIt; ++RefIt)
-		{
-			if (!RefIt->ResolveObjectPtr())
+		TArray<FObjectKey>& Referencers = PreloadedCueReferencers.FindChecked(*CueIt);
+		Referencers.RemoveAllSwap([](const FObjectKey& Ref)
 			{
-				RefIt.RemoveCurrent();
-			}
-		}
-		if (ReferencerSet.Num() == 0)
+				return Ref.ResolveObjectPtr() == nullptr;
+			});
+
+		if (Referencers.Num() == 0)
 		{
 			PreloadedCueReferencers.Remove(*CueIt);
 			CueIt.RemoveCurrent();
 		}
 	}
+
+	if (NumCueMissesThisMap > 0)
+	{
+		UE_LOG(LogLyra, Log, TEXT("ULyraGameplayCueManager: %d gameplay cues were invoked before they were loaded during the previous map"), NumCueMissesThisMap);
+	}
+	NumCueMissesThisMap = 0;
 }
 
 void ULyraGameplayCueManager::UpdateDelayLoadDelegateListeners()
@@ -8,6 +8,7 @@
 
 class FString;
 class UClass;
+class UGameplayCueSet;
 class UObject;
 class UWorld;
 struct FObjectKey;
@@ -32,6 +33,7 @@ public:
 	virtual bool ShouldAsyncLoadRuntimeObjectLibraries() const override;
 	virtual bool ShouldSyncLoadMissingGameplayCues() const override;
 	virtual bool ShouldAsyncLoadMissingGameplayCues() const override;
+	virtual bool HandleMissingGameplayCue(UGameplayCueSet* OwningSet, struct FGameplayCueNotifyData& CueData, AActor* TargetActor, EGameplayCueEvent::Type EventType, FGameplayCueParameters& Parameters) override;
 	//~End of UGameplayCueManager interface
 
 	static void DumpGameplayCues(const TArray<FString>& Args);
@@ -42,12 +44,16 @@ public:
 	// Updates the bundles for the singular gameplay cue primary asset
 	void RefreshGameplayCuePrimaryAsset();
 
+	// Number of cues that were invoked before they were loaded since the last map load
+	int32 GetNumCueMissesThisMap() const { return NumCueMissesThisMap; }
+
 private:
 	void OnGameplayTagLoaded(const FGameplayTag& Tag);
 	void HandlePostGarbageCollect();
 	void ProcessLoadedTags();
 	void ProcessTagToPreload(const FGameplayTag& Tag, UObject* OwningObject);
-	void OnPreloadCueComplete(FSoftObjectPath Path, TWeakObjectPtr<UObject> OwningObject, bool bAlwaysLoadedCue);
+	void StreamPendingPreloads();
+	void OnPreloadCuesComplete(int32 BatchId);
 	void RegisterPreloadedCue(UClass* LoadedGameplayCueClass, UObject* OwningObject);
 	void HandlePostLoadMap(UWorld* NewWorld);
 	void UpdateDelayLoadDelegateListeners();
@@ -63,11 +69,27 @@ private:
 		FLoadedGameplayTagToProcessData(const FGameplayTag& InTag, const TWeakObjectPtr<UObject>& InWeakOwner) : Tag(InTag), WeakOwner(InWeakOwner) {}
 	};
 
+	struct FPendingPreloadCue
+	{
+		FSoftObjectPath Path;
+		TWeakObjectPtr<UObject> WeakOwner;
+		bool bAlwaysLoadedCue = false;
+	};
+
+	// Cues waiting on the same streaming request
+	struct FPreloadBatch
+	{
+		TArray<FPendingPreloadCue> Cues;
+		TSharedPtr<FStreamableHandle> Handle;
+	};
+
 private:
 	// Cues that were preloaded on the client due to being referenced by content
 	UPROPERTY(transient)
 	TSet<TObjectPtr<UClass>> PreloadedCues;
-	TMap<FObjectKey, TSet<FObjectKey>> PreloadedCueReferencers;
+
+	// Objects referencing each preloaded cue, a cue stays preloaded while any of them is alive
+	TMap<FObjectKey, TArray<FObjectKey>> PreloadedCueReferencers;
 
 	// Cues that were preloaded on the client and will always be loaded (code referenced or explicitly always loaded)
 	UPROPERTY(transient)
@@ -76,4 +98,11 @@ private:
 	TArray<FLoadedGameplayTagToProcessData> LoadedGameplayTagsToProcess;
 	FCriticalSection LoadedGameplayTagsToProcessCS;
 	bool bProcessLoadedTagsAfterGC = false;
+
+	// Cues gathered by ProcessTagToPreload that still need to be requested, streamed together by StreamPendingPreloads
+	TArray<FPendingPreloadCue> PendingPreloadCues;
+	TMap<int32, FPreloadBatch> PreloadBatches;
+	int32 NextPreloadBatchId = 0;
+
+	int32 NumCueMissesThisMap = 0;
 };
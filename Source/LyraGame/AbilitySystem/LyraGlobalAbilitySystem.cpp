@@ -3,20 +3,24 @@
 #include "LyraGlobalAbilitySystem.h"
 
 #include "AbilitySystem/LyraAbilitySystemComponent.h"
+#include "GameplayCueManager.h"
+#include "HAL/IConsoleManager.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(LyraGlobalAbilitySystem)
 
-void FGlobalAppliedAbilityList::AddToASC(TSubclassOf<UGameplayAbility> Ability, ULyraAbilitySystemComponent* ASC)
+namespace LyraGlobalAbilitySystem
 {
-	if (FGameplayAbilitySpecHandle* SpecHandle = Handles.Find(ASC))
-	{
-		RemoveFromASC(ASC);
-	}
+	static float ApplicationBudgetMs = 1.0f;
+	static FAutoConsoleVariableRef CVarApplicationBudgetMs(
+		TEXT("Lyra.GlobalAbilitySystem.ApplicationBudgetMs"),
+		ApplicationBudgetMs,
+		TEXT("Time in milliseconds spent per frame applying global abilities and effects to ASCs. Zero or less applies everything immediately."),
+		ECVF_Default);
+}
 
-	UGameplayAbility* AbilityCDO = Ability->GetDefaultObject<UGameplayAbility>();
-	FGameplayAbilitySpec AbilitySpec(AbilityCDO);
-	const FGameplayAbilitySpecHandle AbilitySpecHandle = ASC->GiveAbility(AbilitySpec);
-	Handles.Add(ASC, AbilitySpecHandle);
+void FGlobalAppliedAbilityList::AddHandle(ULyraAbilitySystemComponent* ASC, FGameplayAbilitySpecHandle Handle)
+{
+	Handles.Add(ASC, Handle);
 }
 
 void FGlobalAppliedAbilityList::RemoveFromASC(ULyraAbilitySystemComponent* ASC)
@@ -49,6 +53,7 @@ void FGlobalAppliedEffectList::AddToASC(TSubclassOf<UGameplayEffect> Effect, ULy
 		RemoveFromASC(ASC);
 	}
 
+	// Each target gets its own context, since executions, cues and attribute sets read the instigator and causer from it
 	const UGameplayEffect* GameplayEffectCDO = Effect->GetDefaultObject<UGameplayEffect>();
 	const FActiveGameplayEffectHandle GameplayEffectHandle = ASC->ApplyGameplayEffectToSelf(GameplayEffectCDO, /*Level=*/ 1, ASC->MakeEffectContext());
 	Handles.Add(ASC, GameplayEffectHandle);
@@ -79,14 +84,36 @@ ULyraGlobalAbilitySystem::ULyraGlobalAbilitySystem()
 {
 }
 
+void ULyraGlobalAbilitySystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	ProcessPendingApplications(LyraGlobalAbilitySystem::ApplicationBudgetMs * 0.001);
+}
+
+bool ULyraGlobalAbilitySystem::IsTickable() const
+{
+	return (NextPendingIndex < PendingApplications.Num()) && Super::IsTickable();
+}
+
+TStatId ULyraGlobalAbilitySystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(ULyraGlobalAbilitySystem, STATGROUP_Tickables);
+}
+
 void ULyraGlobalAbilitySystem::ApplyAbilityToAll(TSubclassOf<UGameplayAbility> Ability)
 {
 	if ((Ability.Get() != nullptr) && (!AppliedAbilities.Contains(Ability)))
 	{
-		FGlobalAppliedAbilityList& Entry = AppliedAbilities.Add(Ability);		
+		AppliedAbilities.Add(Ability);
 		for (ULyraAbilitySystemComponent* ASC : RegisteredASCs)
 		{
-			Entry.AddToASC(Ability, ASC);
+			FindOrAddPendingApplication(ASC).Abilities.AddUnique(Ability);
+		}
+
+		if (LyraGlobalAbilitySystem::ApplicationBudgetMs <= 0.0f)
+		{
+			ProcessPendingApplications(0.0);
 		}
 	}
 }
@@ -95,10 +122,15 @@ void ULyraGlobalAbilitySystem::ApplyEffectToAll(TSubclassOf<UGameplayEffect> Eff
 {
 	if ((Effect.Get() != nullptr) && (!AppliedEffects.Contains(Effect)))
 	{
-		FGlobalAppliedEffectList& Entry = AppliedEffects.Add(Effect);
+		AppliedEffects.Add(Effect);
 		for (ULyraAbilitySystemComponent* ASC : RegisteredASCs)
 		{
-			Entry.AddToASC(Effect, ASC);
+			FindOrAddPendingApplication(ASC).Effects.AddUnique(Effect);
+		}
+
+		if (LyraGlobalAbilitySystem::ApplicationBudgetMs <= 0.0f)
+		{
+			ProcessPendingApplications(0.0);
 		}
 	}
 }
@@ -127,13 +159,22 @@ void ULyraGlobalAbilitySystem::RegisterASC(ULyraAbilitySystemComponent* ASC)
 {
 	check(ASC);
 
-	for (auto& Entry : AppliedAbilities)
-	{
-		Entry.Value.AddToASC(Entry.Key, ASC);
-	}
-	for (auto& Entry : AppliedEffects)
+	if ((AppliedAbilities.Num() > 0) || (AppliedEffects.Num() > 0))
 	{
-		Entry.Value.AddToASC(Entry.Key, ASC);
+		FLyraPendingGlobalApplication& Pending = FindOrAddPendingApplication(ASC);
+		for (auto& Entry : AppliedAbilities)
+		{
+			Pending.Abilities.AddUnique(Entry.Key);
+		}
+		for (auto& Entry : AppliedEffects)
+		{
+			Pending.Effects.AddUnique(Entry.Key);
+		}
+
+		if (LyraGlobalAbilitySystem::ApplicationBudgetMs <= 0.0f)
+		{
+			ProcessPendingApplications(0.0);
+		}
 	}
 
 	RegisteredASCs.AddUnique(ASC);
@@ -142,6 +183,14 @@ void ULyraGlobalAbilitySystem::RegisterASC(ULyraAbilitySystemComponent* ASC)
 void ULyraGlobalAbilitySystem::UnregisterASC(ULyraAbilitySystemComponent* ASC)
 {
 	check(ASC);
+
+	// Drop anything that hasn't been applied yet
+	int32 PendingIndex = INDEX_NONE;
+	if (PendingIndexByASC.RemoveAndCopyValue(ASC, PendingIndex))
+	{
+		PendingApplications[PendingIndex] = FLyraPendingGlobalApplication();
+	}
+
 	for (auto& Entry : AppliedAbilities)
 	{
 		Entry.Value.RemoveFromASC(ASC);
@@ -154,3 +203,86 @@ void ULyraGlobalAbilitySystem::UnregisterASC(ULyraAbilitySystemComponent* ASC)
 	RegisteredASCs.Remove(ASC);
 }
 
+
+FLyraPendingGlobalApplication& ULyraGlobalAbilitySystem::FindOrAddPendingApplication(ULyraAbilitySystemComponent* ASC)
+{
+	if (const int32* PendingIndex = PendingIndexByASC.Find(ASC))
+	{
+		return PendingApplications[*PendingIndex];
+	}
+
+	const int32 NewIndex = PendingApplications.AddDefaulted();
+	PendingApplications[NewIndex].ASC = ASC;
+	PendingIndexByASC.Add(ASC, NewIndex);
+	return PendingApplications[NewIndex];
+}
+
+void ULyraGlobalAbilitySystem::ProcessPendingApplications(double TimeBudgetSeconds)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	while (NextPendingIndex < PendingApplications.Num())
+	{
+		// Move it out, applying can register new ASCs and grow the queue
+		const FLyraPendingGlobalApplication Pending = MoveTemp(PendingApplications[NextPendingIndex]);
+		++NextPendingIndex;
+
+		if (ULyraAbilitySystemComponent* ASC = Pending.ASC.Get())
+		{
+			PendingIndexByASC.Remove(ASC);
+			ApplyPendingToASC(ASC, Pending);
+		}
+
+		// Always make some progress, even with a tiny budget
+		if ((TimeBudgetSeconds > 0.0) && ((FPlatformTime::Seconds() - StartTime) >= TimeBudgetSeconds))
+		{
+			break;
+		}
+	}
+
+	if (NextPendingIndex >= PendingApplications.Num())
+	{
+		PendingApplications.Reset();
+		PendingIndexByASC.Reset();
+		NextPendingIndex = 0;
+	}
+}
+
+void ULyraGlobalAbilitySystem::ApplyPendingToASC(ULyraAbilitySystemComponent* ASC, const FLyraPendingGlobalApplication& Pending)
+{
+	// Send the cues of all effects together
+	FScopedGameplayCueSendContext GameplayCueSendContext;
+
+	// Grant all abilities in one batch
+	TArray<TSubclassOf<UGameplayAbility>, TInlineAllocator<8>> AbilitiesToGrant;
+	TArray<FGameplayAbilitySpec, TInlineAllocator<8>> AbilitySpecs;
+	for (const TSubclassOf<UGameplayAbility>& Ability : Pending.Abilities)
+	{
+		// Skip anything that was removed again while it was queued
+		if (FGlobalAppliedAbilityList* Entry = AppliedAbilities.Find(Ability))
+		{
+			Entry->RemoveFromASC(ASC);
+			AbilitiesToGrant.Add(Ability);
+			AbilitySpecs.Emplace(Ability->GetDefaultObject<UGameplayAbility>());
+		}
+	}
+
+	if (AbilitySpecs.Num() > 0)
+	{
+		TArray<FGameplayAbilitySpecHandle> AbilityHandles;
+		ASC->GiveAbilities(AbilitySpecs, AbilityHandles);
+
+		for (int32 AbilityIndex = 0; AbilityIndex < AbilitiesToGrant.Num(); ++AbilityIndex)
+		{
+			AppliedAbilities.FindChecked(AbilitiesToGrant[AbilityIndex]).AddHandle(ASC, AbilityHandles[AbilityIndex]);
+		}
+	}
+
+	for (const TSubclassOf<UGameplayEffect>& Effect : Pending.Effects)
+	{
+		if (FGlobalAppliedEffectList* Entry = AppliedEffects.Find(Effect))
+		{
+			Entry->AddToASC(Effect, ASC);
+		}
+	}
+}
@@ -6,6 +6,7 @@
 #include "Subsystems/WorldSubsystem.h"
 #include "GameplayAbilitySpecHandle.h"
 #include "Templates/SubclassOf.h"
+#include "UObject/ObjectKey.h"
 
 #include "LyraGlobalAbilitySystem.generated.h"
 
@@ -25,7 +26,7 @@ struct FGlobalAppliedAbilityList
 	UPROPERTY()
 	TMap<TObjectPtr<ULyraAbilitySystemComponent>, FGameplayAbilitySpecHandle> Handles;
 
-	void AddToASC(TSubclassOf<UGameplayAbility> Ability, ULyraAbilitySystemComponent* ASC);
+	void AddHandle(ULyraAbilitySystemComponent* ASC, FGameplayAbilitySpecHandle Handle);
 	void RemoveFromASC(ULyraAbilitySystemComponent* ASC);
 	void RemoveFromAll();
 };
@@ -43,14 +44,34 @@ struct FGlobalAppliedEffectList
 	void RemoveFromAll();
 };
 
+/** Global abilities and effects that still have to be applied to one ASC */
+struct FLyraPendingGlobalApplication
+{
+	TWeakObjectPtr<ULyraAbilitySystemComponent> ASC;
+	TArray<TSubclassOf<UGameplayAbility>> Abilities;
+	TArray<TSubclassOf<UGameplayEffect>> Effects;
+};
+
+/**
+ * Applies abilities and effects to every registered ASC.
+ *
+ * Applications are queued per ASC and worked off over several frames under a time budget,
+ * so granting a global effect to a large number of ASCs doesn't hitch the server.
+ */
 UCLASS()
-class ULyraGlobalAbilitySystem : public UWorldSubsystem
+class ULyraGlobalAbilitySystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
 public:
 	ULyraGlobalAbilitySystem();
 
+	//~FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+	//~End of FTickableGameObject interface
+
 	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category="Lyra")
 	void ApplyAbilityToAll(TSubclassOf<UGameplayAbility> Ability);
 
@@ -69,6 +90,14 @@ public:
 	/** Removes an ASC from the global system, along with any active global effects/abilities. */
 	void UnregisterASC(ULyraAbilitySystemComponent* ASC);
 
+private:
+	FLyraPendingGlobalApplication& FindOrAddPendingApplication(ULyraAbilitySystemComponent* ASC);
+
+	/** Applies queued work until the time budget is used up, a budget of zero or less applies everything */
+	void ProcessPendingApplications(double TimeBudgetSeconds);
+
+	void ApplyPendingToASC(ULyraAbilitySystemComponent* ASC, const FLyraPendingGlobalApplication& Pending);
+
 private:
 	UPROPERTY()
 	TMap<TSubclassOf<UGameplayAbility>, FGlobalAppliedAbilityList> AppliedAbilities;
@@ -78,4 +107,11 @@ private:
 
 	UPROPERTY()
 	TArray<TObjectPtr<ULyraAbilitySystemComponent>> RegisteredASCs;
+
+	// Queued applications, in order. Entries before NextPendingIndex have been processed.
+	TArray<FLyraPendingGlobalApplication> PendingApplications;
+	int32 NextPendingIndex = 0;
+
+	// Index of the unprocessed pending application of each ASC
+	TMap<TObjectKey<ULyraAbilitySystemComponent>, int32> PendingIndexByASC;
 };
@@ -0,0 +1,81 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LyraCameraFocusSubsystem.h"
+
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(LyraCameraFocusSubsystem)
+
+namespace LyraCameraFocus
+{
+	static float TraceDistance = 10000.0f;
+	static FAutoConsoleVariableRef CVarTraceDistance(
+		TEXT("Lyra.Camera.FocusTraceDistance"),
+		TraceDistance,
+		TEXT("How far the shared camera focus trace reaches, users that need less ignore hits past their own range"),
+		ECVF_Default);
+}
+
+ULyraCameraFocusSubsystem* ULyraCameraFocusSubsystem::Get(const APlayerController* PC)
+{
+	const ULocalPlayer* LocalPlayer = PC ? PC->GetLocalPlayer() : nullptr;
+	return LocalPlayer ? LocalPlayer->GetSubsystem<ULyraCameraFocusSubsystem>() : nullptr;
+}
+
+const FLyraCameraFocus& ULyraCameraFocusSubsystem::GetCameraFocus(FName TraceProfile)
+{
+	FCachedCameraFocus& Cached = CachedFocusByProfile.FindOrAdd(TraceProfile);
+
+	const APlayerController* PC = GetLocalPlayer() ? GetLocalPlayer()->GetPlayerController(nullptr) : nullptr;
+	UWorld* World = PC ? PC->GetWorld() : nullptr;
+	if (World == nullptr)
+	{
+		Cached.Focus = FLyraCameraFocus();
+		return Cached.Focus;
+	}
+
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+	// The camera updates late in the frame, so anyone asking after that gets a fresh trace
+	const bool bIsUpToDate = (Cached.FrameNumber == GFrameCounter) && Cached.Focus.ViewLocation.Equals(ViewLocation) && Cached.Focus.ViewRotation.Equals(ViewRotation);
+	if (bIsUpToDate)
+	{
+		return Cached.Focus;
+	}
+
+	Cached.FrameNumber = GFrameCounter;
+	Cached.Focus.ViewLocation = ViewLocation;
+	Cached.Focus.ViewRotation = ViewRotation;
+
+	const bool bTraceComplex = false;
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(LyraCameraFocus), bTraceComplex);
+	Params.AddIgnoredActor(PC->GetPawn());
+
+	const FVector TraceEnd = ViewLocation + (ViewRotation.Vector() * LyraCameraFocus::TraceDistance);
+
+	TArray<FHitResult> HitResults;
+	World->LineTraceMultiByProfile(HitResults, ViewLocation, TraceEnd, TraceProfile, Params);
+
+	Cached.Focus.bHasHit = (HitResults.Num() > 0);
+	if (Cached.Focus.bHasHit)
+	{
+		Cached.Focus.Hit = HitResults[0];
+	}
+	else
+	{
+		Cached.Focus.Hit = FHitResult(ViewLocation, TraceEnd);
+	}
+
+	return Cached.Focus;
+}
+
+FLyraCameraFocus ULyraCameraFocusSubsystem::K2_GetCameraFocus(FName TraceProfile)
+{
+	return GetCameraFocus(TraceProfile);
+}
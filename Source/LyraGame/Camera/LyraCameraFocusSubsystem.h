@@ -0,0 +1,65 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Engine/HitResult.h"
+#include "Subsystems/LocalPlayerSubsystem.h"
+
+#include "LyraCameraFocusSubsystem.generated.h"
+
+#define UE_API LYRAGAME_API
+
+class APlayerController;
+class UObject;
+
+/** What the local player's camera is looking at */
+USTRUCT(BlueprintType)
+struct FLyraCameraFocus
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="Camera")
+	FVector ViewLocation = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category="Camera")
+	FRotator ViewRotation = FRotator::ZeroRotator;
+
+	// First hit along the view ray, its distance is measured from ViewLocation
+	UPROPERTY(BlueprintReadOnly, Category="Camera")
+	FHitResult Hit;
+
+	UPROPERTY(BlueprintReadOnly, Category="Camera")
+	bool bHasHit = false;
+};
+
+/**
+ * Traces from the local player's camera at most once per frame and trace profile, and shares the result with every
+ * system that needs to know what the player is looking at (interaction prompts, reticles, ...).
+ * The trace is repeated within a frame only if the view moved in between.
+ */
+UCLASS(MinimalAPI)
+class ULyraCameraFocusSubsystem : public ULocalPlayerSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Returns the subsystem of the controller's local player, null for controllers that aren't local
+	static UE_API ULyraCameraFocusSubsystem* Get(const APlayerController* PC);
+
+	// Returns the camera focus for the given trace profile, tracing only if this frame's result is missing or out of date
+	UE_API const FLyraCameraFocus& GetCameraFocus(FName TraceProfile);
+
+	UFUNCTION(BlueprintCallable, Category="Lyra|Camera", meta=(DisplayName="Get Camera Focus"))
+	UE_API FLyraCameraFocus K2_GetCameraFocus(FName TraceProfile);
+
+private:
+	struct FCachedCameraFocus
+	{
+		uint64 FrameNumber = 0;
+		FLyraCameraFocus Focus;
+	};
+
+	TMap<FName, FCachedCameraFocus> CachedFocusByProfile;
+};
+
+#undef UE_API
@@ -17,6 +17,13 @@
 namespace LyraCameraMode_ThirdPerson_Statics
 {
 	static const FName NAME_IgnoreCameraCollision = TEXT("IgnoreCameraCollision");
+
+	static bool bAsyncPenetrationFeelers = true;
+	static FAutoConsoleVariableRef CVarAsyncPenetrationFeelers(
+		TEXT("LyraCamera.AsyncPenetrationFeelers"),
+		bAsyncPenetrationFeelers,
+		TEXT("If true, the predictive camera penetration feelers are swept asynchronously and used the following frame. The main ray is always synchronous.")
+	);
 }
 
 ULyraCameraMode_ThirdPerson::ULyraCameraMode_ThirdPerson()
@@ -201,9 +208,42 @@ void ULyraCameraMode_ThirdPerson::PreventCameraPenetration(class AActor const& V
 	FCollisionShape SphereShape = FCollisionShape::MakeSphere(0.f);
 	UWorld* World = GetWorld();
 
+	// Don't let the async sweeps stop on actors we already know to ignore
+	IgnoredCameraCollisionActors.RemoveAll([](const TWeakObjectPtr<const AActor>& Actor) { return !Actor.IsValid(); });
+	for (const TWeakObjectPtr<const AActor>& IgnoredActor : IgnoredCameraCollisionActors)
+	{
+		SphereParams.AddIgnoredActor(IgnoredActor.Get());
+	}
+
+	const bool bAsyncFeelers = LyraCameraMode_ThirdPerson_Statics::bAsyncPenetrationFeelers;
+	FeelerTraceStates.SetNum(PenetrationAvoidanceFeelers.Num());
+	if (bResetInterpolation)
+	{
+		// Results from before the reset don't describe where the camera is now
+		for (FLyraFeelerTraceState& TraceState : FeelerTraceStates)
+		{
+			TraceState = FLyraFeelerTraceState();
+		}
+	}
+
 	for (int32 RayIdx = 0; RayIdx < NumRaysToShoot; ++RayIdx)
 	{
 		FLyraPenetrationAvoidanceFeeler& Feeler = PenetrationAvoidanceFeelers[RayIdx];
+		bool const bAsyncFeeler = bAsyncFeelers && (RayIdx > 0);
+
+		if (bAsyncFeeler)
+		{
+			float FeelerBlockedPct = 1.f;
+			if (ConsumeFeelerTrace(RayIdx, ViewTarget, SphereParams, FeelerBlockedPct))
+			{
+				DistBlockedPctThisFrame = FMath::Min(FeelerBlockedPct, DistBlockedPctThisFrame);
+				SoftBlockedPct = DistBlockedPctThisFrame;
+
+				// This feeler got a hit, so do another trace this frame
+				Feeler.FramesUntilNextTrace = 0;
+			}
+		}
+
 		if (Feeler.FramesUntilNextTrace <= 0)
 		{
 			// calc ray target
@@ -219,6 +259,15 @@ void ULyraCameraMode_ThirdPerson::PreventCameraPenetration(class AActor const& V
 			SphereShape.Sphere.Radius = Feeler.Extent;
 			ECollisionChannel TraceChannel = ECC_Camera;		//(Feeler.PawnWeight > 0.f) ? ECC_Pawn : ECC_Camera;
 
+			Feeler.FramesUntilNextTrace = Feeler.TraceInterval;
+
+			if (bAsyncFeeler)
+			{
+				// Consumed next frame, by then the result is used as a fraction of the new ray
+				FeelerTraceStates[RayIdx].PendingTrace = World->AsyncSweepByChannel(EAsyncTraceType::Single, SafeLoc, RayTarget, FQuat::Identity, TraceChannel, SphereShape, SphereParams);
+				continue;
+			}
+
 			// do multi-line check to make sure the hits we throw out aren't
 			// masking real hits behind (these are important rays).
 
@@ -234,59 +283,18 @@ void ULyraCameraMode_ThirdPerson::PreventCameraPenetration(class AActor const& V
 			}
 #endif // ENABLE_DRAW_DEBUG
 
-			Feeler.FramesUntilNextTrace = Feeler.TraceInterval;
-
-			const AActor* HitActor = Hit.GetActor();
-
-			if (bHit && HitActor)
+			if (bHit && Hit.GetActor() && !ShouldIgnorePenetrationHit(ViewTarget, Hit, SphereParams))
 			{
-				bool bIgnoreHit = false;
+				float const Weight = Cast<APawn>(Hit.GetActor()) ? Feeler.PawnWeight : Feeler.WorldWeight;
+				float NewBlockPct = Hit.Time;
+				NewBlockPct += (1.f - NewBlockPct) * (1.f - Weight);
 
-				if (HitActor->ActorHasTag(LyraCameraMode_ThirdPerson_Statics::NAME_IgnoreCameraCollision))
-				{
-					bIgnoreHit = true;
-					SphereParams.AddIgnoredActor(HitActor);
-				}
+				// Recompute blocked pct taking into account pushout distance.
+				NewBlockPct = ((Hit.Location - SafeLoc).Size() - CollisionPushOutDistance) / (RayTarget - SafeLoc).Size();
+				DistBlockedPctThisFrame = FMath::Min(NewBlockPct, DistBlockedPctThisFrame);
 
-				// Ignore CameraBlockingVolume hits that occur in front of the ViewTarget.
-				if (!bIgnoreHit && HitActor->IsA<ACameraBlockingVolume>())
-				{
-					const FVector ViewTargetForwardXY = ViewTarget.GetActorForwardVector().GetSafeNormal2D();
-					const FVector ViewTargetLocation = ViewTarget.GetActorLocation();
-					const FVector HitOffset = Hit.Location - ViewTargetLocation;
-					const FVector HitDirectionXY = HitOffset.GetSafeNormal2D();
-					const float DotHitDirection = FVector::DotProduct(ViewTargetForwardXY, HitDirectionXY);
-					if (DotHitDirection > 0.0f)
-					{
-						bIgnoreHit = true;
-						// Ignore this CameraBlockingVolume on the remaining sweeps.
-						SphereParams.AddIgnoredActor(HitActor);
-					}
-					else
-					{
-#if ENABLE_DRAW_DEBUG
-						DebugActorsHitDuringCameraPenetration.AddUnique(TObjectPtr<const AActor>(HitActor));
-#endif
-					}
-				}
-				
-				if (!bIgnoreHit)
-				{
-					float const Weight = Cast<APawn>(Hit.GetActor()) ? Feeler.PawnWeight : Feeler.WorldWeight;
-					float NewBlockPct = Hit.Time;
-					NewBlockPct += (1.f - NewBlockPct) * (1.f - Weight);
-
-					// Recompute blocked pct taking into account pushout distance.
-					NewBlockPct = ((Hit.Location - SafeLoc).Size() - CollisionPushOutDistance) / (RayTarget - SafeLoc).Size();
-					DistBlockedPctThisFrame = FMath::Min(NewBlockPct, DistBlockedPctThisFrame);
-
-					// This feeler got a hit, so do another trace next frame
-					Feeler.FramesUntilNextTrace = 0;
-
-#if ENABLE_DRAW_DEBUG
-					DebugActorsHitDuringCameraPenetration.AddUnique(TObjectPtr<const AActor>(HitActor));
-#endif
-				}
+				// This feeler got a hit, so do another trace next frame
+				Feeler.FramesUntilNextTrace = 0;
 			}
 
 			if (RayIdx == 0)
@@ -349,6 +357,88 @@ void ULyraCameraMode_ThirdPerson::PreventCameraPenetration(class AActor const& V
 	}
 }
 
+bool ULyraCameraMode_ThirdPerson::ShouldIgnorePenetrationHit(AActor const& ViewTarget, FHitResult const& Hit, FCollisionQueryParams& SphereParams)
+{
+	const AActor* HitActor = Hit.GetActor();
+
+	if (HitActor->ActorHasTag(LyraCameraMode_ThirdPerson_Statics::NAME_IgnoreCameraCollision))
+	{
+		SphereParams.AddIgnoredActor(HitActor);
+		IgnoredCameraCollisionActors.AddUnique(HitActor);
+		return true;
+	}
+
+	// Ignore CameraBlockingVolume hits that occur in front of the ViewTarget.
+	if (HitActor->IsA<ACameraBlockingVolume>())
+	{
+		const FVector ViewTargetForwardXY = ViewTarget.GetActorForwardVector().GetSafeNormal2D();
+		const FVector ViewTargetLocation = ViewTarget.GetActorLocation();
+		const FVector HitOffset = Hit.Location - ViewTargetLocation;
+		const FVector HitDirectionXY = HitOffset.GetSafeNormal2D();
+		const float DotHitDirection = FVector::DotProduct(ViewTargetForwardXY, HitDirectionXY);
+		if (DotHitDirection > 0.0f)
+		{
+			// Ignore this CameraBlockingVolume on the remaining sweeps.
+			SphereParams.AddIgnoredActor(HitActor);
+			return true;
+		}
+	}
+
+#if ENABLE_DRAW_DEBUG
+	DebugActorsHitDuringCameraPenetration.AddUnique(TObjectPtr<const AActor>(HitActor));
+#endif
+
+	return false;
+}
+
+bool ULyraCameraMode_ThirdPerson::ConsumeFeelerTrace(int32 RayIdx, AActor const& ViewTarget, FCollisionQueryParams& SphereParams, float& OutBlockedPct)
+{
+	FLyraFeelerTraceState& TraceState = FeelerTraceStates[RayIdx];
+	if (!TraceState.PendingTrace.IsValid())
+	{
+		return false;
+	}
+
+	UWorld* World = GetWorld();
+
+	FTraceDatum TraceData;
+	const bool bHasResult = World->QueryTraceData(TraceState.PendingTrace, TraceData);
+	TraceState.PendingTrace = FTraceHandle();
+	if (!bHasResult)
+	{
+		return false;
+	}
+
+	const FHitResult* Hit = TraceData.OutHits.FindByPredicate([](const FHitResult& Candidate) { return Candidate.bBlockingHit; });
+	const bool bHit = Hit && Hit->GetActor() && !ShouldIgnorePenetrationHit(ViewTarget, *Hit, SphereParams);
+
+#if ENABLE_DRAW_DEBUG
+	if (World->TimeSince(LastDrawDebugTime) < 1.f)
+	{
+		const FVector TraceEnd = bHit ? Hit->Location : TraceData.End;
+		DrawDebugSphere(World, TraceData.Start, TraceData.CollisionParams.CollisionShape.GetSphereRadius(), 8, FColor::Orange);
+		DrawDebugSphere(World, TraceEnd, TraceData.CollisionParams.CollisionShape.GetSphereRadius(), 8, FColor::Orange);
+		DrawDebugLine(World, TraceData.Start, TraceEnd, FColor::Orange);
+	}
+#endif // ENABLE_DRAW_DEBUG
+
+	// Relative to the ray length, so it still applies after the camera moved
+	float MeasuredPct = 1.f;
+	if (bHit)
+	{
+		MeasuredPct = ((Hit->Location - TraceData.Start).Size() - CollisionPushOutDistance) / (TraceData.End - TraceData.Start).Size();
+	}
+
+	TraceState.PreviousBlockedPct = TraceState.BlockedPct;
+	TraceState.BlockedPct = MeasuredPct;
+
+	// The result is a frame old. If the feeler is closing in, extrapolate one more frame so the camera doesn't pull in late.
+	const float ClosingRate = FMath::Min(TraceState.BlockedPct - TraceState.PreviousBlockedPct, 0.f);
+	OutBlockedPct = FMath::Max(TraceState.BlockedPct + ClosingRate, 0.f);
+
+	return bHit;
+}
+
 void ULyraCameraMode_ThirdPerson::SetTargetCrouchOffset(FVector NewTargetOffset)
 {
 	CrouchOffsetBlendPct = 0.0f;
@@ -6,10 +6,24 @@
 #include "Curves/CurveFloat.h"
 #include "LyraPenetrationAvoidanceFeeler.h"
 #include "DrawDebugHelpers.h"
+#include "WorldCollision.h"
 #include "LyraCameraMode_ThirdPerson.generated.h"
 
 class UCurveVector;
 
+/**
+ * Runtime state of a predictive feeler, swept asynchronously and read back the next frame.
+ */
+struct FLyraFeelerTraceState
+{
+	/** Sweep submitted last frame, if any */
+	FTraceHandle PendingTrace;
+
+	/** Blocked percentages of the last two results, used to extrapolate over the frame of latency */
+	float BlockedPct = 1.0f;
+	float PreviousBlockedPct = 1.0f;
+};
+
 /**
  * ULyraCameraMode_ThirdPerson
  *
@@ -32,6 +46,12 @@ protected:
 	void UpdatePreventPenetration(float DeltaTime);
 	void PreventCameraPenetration(class AActor const& ViewTarget, FVector const& SafeLoc, FVector& CameraLoc, float const& DeltaTime, float& DistBlockedPct, bool bSingleRayOnly);
 
+	/** Returns true if a penetration sweep hit should not block the camera, adding it to the ignored actors of the remaining sweeps if so */
+	bool ShouldIgnorePenetrationHit(AActor const& ViewTarget, FHitResult const& Hit, FCollisionQueryParams& SphereParams);
+
+	/** Reads back last frame's sweep of a predictive feeler, returns false if there was none or it missed */
+	bool ConsumeFeelerTrace(int32 RayIdx, AActor const& ViewTarget, FCollisionQueryParams& SphereParams, float& OutBlockedPct);
+
 	virtual void DrawDebug(UCanvas* Canvas) const override;
 
 protected:
@@ -101,6 +121,12 @@ public:
 	mutable float LastDrawDebugTime = -MAX_FLT;
 #endif
 
+	/** Async state for PenetrationAvoidanceFeelers, the main ray (index 0) is always swept synchronously */
+	TArray<FLyraFeelerTraceState> FeelerTraceStates;
+
+	/** Actors tagged to be ignored by camera collision found by earlier sweeps, so async sweeps don't stop on them */
+	TArray<TWeakObjectPtr<const AActor>> IgnoredCameraCollisionActors;
+
 protected:
 	
 	void SetTargetCrouchOffset(FVector NewTargetOffset);
@@ -8,6 +8,7 @@
 #include "Character/LyraPawnExtensionComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "HAL/IConsoleManager.h"
 #include "LyraCharacterMovementComponent.h"
 #include "LyraGameplayTags.h"
 #include "LyraLogChannels.h"
@@ -27,6 +28,16 @@ class UInputComponent;
 static FName NAME_LyraCharacterCollisionProfile_Capsule(TEXT("LyraPawnCapsule"));
 static FName NAME_LyraCharacterCollisionProfile_Mesh(TEXT("LyraPawnMesh"));
 
+namespace LyraCharacter
+{
+	static bool bOnlyTickMontagesOnDedicatedServer = true;
+	static FAutoConsoleVariableRef CVarOnlyTickMontagesOnDedicatedServer(
+		TEXT("Lyra.Character.OnlyTickMontagesOnDedicatedServer"),
+		bOnlyTickMontagesOnDedicatedServer,
+		TEXT("If true, character meshes on dedicated servers only tick montages instead of the full anim graph."),
+		ECVF_Default);
+}
+
 ALyraCharacter::ALyraCharacter(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer.SetDefaultSubobjectClass<ULyraCharacterMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
@@ -83,6 +94,15 @@ ALyraCharacter::ALyraCharacter(const FObjectInitializer& ObjectInitializer)
 void ALyraCharacter::PreInitializeComponents()
 {
 	Super::PreInitializeComponents();
+
+	// Nothing is ever rendered on a dedicated server, only montages need to advance for root motion and gameplay notifies
+	if (LyraCharacter::bOnlyTickMontagesOnDedicatedServer && IsNetMode(NM_DedicatedServer))
+	{
+		if (USkeletalMeshComponent* MeshComp = GetMesh())
+		{
+			MeshComp->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+		}
+	}
 }
 
 void ALyraCharacter::BeginPlay()
@@ -96,7 +116,7 @@ void ALyraCharacter::BeginPlay()
 	{
 		if (ULyraSignificanceManager* SignificanceManager = USignificanceManager::Get<ULyraSignificanceManager>(World))
 		{
-//@TODO: SignificanceManager->RegisterObject(this, (EFortSignificanceType)SignificanceType);
+			SignificanceManager->RegisterCharacter(this);
 		}
 	}
 }
@@ -0,0 +1,80 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LyraCharacterPartMeshActor.h"
+
+#include "Components/ChildActorComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/StaticMesh.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(LyraCharacterPartMeshActor)
+
+ALyraCharacterPartMeshActor::ALyraCharacterPartMeshActor(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	RootComponent = SkeletalMeshComponent = CreateDefaultSubobject<USkeletalMeshComponent>(TEXT("SkeletalMeshComponent"));
+	SkeletalMeshComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+
+	StaticMeshComponent = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("StaticMeshComponent"));
+	StaticMeshComponent->SetupAttachment(RootComponent);
+	StaticMeshComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+}
+
+void ALyraCharacterPartMeshActor::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Spawned as a regular actor, so there was no chance to stream the mesh in ahead of time
+	GetMeshPath().TryLoad();
+
+	// Part actors are normally owned by a child actor component, follow the pose of whatever that is attached to
+	USceneComponent* AttachParent = GetRootComponent()->GetAttachParent();
+	if (UChildActorComponent* ParentComponent = GetParentComponent())
+	{
+		AttachParent = ParentComponent->GetAttachParent();
+	}
+
+	if (IsSkeletalPart())
+	{
+		ApplyToMeshComponent(SkeletalMeshComponent, AttachParent);
+		StaticMeshComponent->SetHiddenInGame(true);
+	}
+	else
+	{
+		ApplyToMeshComponent(StaticMeshComponent, nullptr);
+		SkeletalMeshComponent->SetHiddenInGame(true);
+	}
+}
+
+bool ALyraCharacterPartMeshActor::CanUsePooledComponent() const
+{
+	return bAllowPooledComponent && !GetMeshPath().IsNull();
+}
+
+FSoftObjectPath ALyraCharacterPartMeshActor::GetMeshPath() const
+{
+	return IsSkeletalPart() ? SkeletalMesh.ToSoftObjectPath() : StaticMesh.ToSoftObjectPath();
+}
+
+void ALyraCharacterPartMeshActor::ApplyToMeshComponent(UMeshComponent* MeshComponent, USceneComponent* AttachParent) const
+{
+	if (USkeletalMeshComponent* SkeletalComponent = Cast<USkeletalMeshComponent>(MeshComponent))
+	{
+		SkeletalComponent->SetSkeletalMesh(SkeletalMesh.Get(), /*bReinitPose=*/ true);
+
+		USkeletalMeshComponent* ParentSkeletalComponent = Cast<USkeletalMeshComponent>(AttachParent);
+		SkeletalComponent->SetLeaderPoseComponent(bFollowParentPose ? ParentSkeletalComponent : nullptr);
+	}
+	else if (UStaticMeshComponent* StaticComponent = Cast<UStaticMeshComponent>(MeshComponent))
+	{
+		StaticComponent->SetStaticMesh(StaticMesh.Get());
+	}
+}
+
+UMeshComponent* ALyraCharacterPartMeshActor::GetTemplateMeshComponent() const
+{
+	return IsSkeletalPart() ? static_cast<UMeshComponent*>(SkeletalMeshComponent) : static_cast<UMeshComponent*>(StaticMeshComponent);
+}
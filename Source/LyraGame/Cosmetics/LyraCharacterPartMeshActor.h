@@ -0,0 +1,78 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "AbilitySystem/LyraTaggedActor.h"
+
+#include "LyraCharacterPartMeshActor.generated.h"
+
+#define UE_API LYRAGAME_API
+
+class UMeshComponent;
+class UObject;
+class USceneComponent;
+class USkeletalMesh;
+class USkeletalMeshComponent;
+class UStaticMesh;
+class UStaticMeshComponent;
+
+/**
+ * A character part that is nothing more than a single mesh
+ *
+ * When used as a part class, ULyraPawnComponent_CharacterParts doesn't spawn this actor at all: it streams the mesh
+ * in asynchronously and attaches a pooled mesh component directly to the pawn, configured from the class defaults.
+ * Components and logic added in Blueprint subclasses are only used when pooling is disabled for the class.
+ */
+UCLASS(MinimalAPI, Abstract, Blueprintable)
+class ALyraCharacterPartMeshActor : public ALyraTaggedActor
+{
+	GENERATED_BODY()
+
+public:
+	UE_API ALyraCharacterPartMeshActor(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	//~AActor interface
+	UE_API virtual void BeginPlay() override;
+	//~End of AActor interface
+
+	// Returns true if this part can be represented by a pooled mesh component instead of a spawned actor
+	UE_API bool CanUsePooledComponent() const;
+
+	// Returns true if the part mesh is a skeletal mesh, false if it is a static mesh
+	bool IsSkeletalPart() const { return !SkeletalMesh.IsNull(); }
+
+	// The mesh asset to stream in for this part
+	UE_API FSoftObjectPath GetMeshPath() const;
+
+	// Applies the loaded part mesh and settings from this actor to a mesh component attached to AttachParent
+	UE_API void ApplyToMeshComponent(UMeshComponent* MeshComponent, USceneComponent* AttachParent) const;
+
+	// Returns the component on this actor (or its class defaults) that pooled components copy their settings from
+	UE_API UMeshComponent* GetTemplateMeshComponent() const;
+
+protected:
+	// Skeletal mesh to display, takes priority over StaticMesh
+	UPROPERTY(EditDefaultsOnly, Category=Cosmetics)
+	TSoftObjectPtr<USkeletalMesh> SkeletalMesh;
+
+	// Static mesh to display when there is no skeletal mesh
+	UPROPERTY(EditDefaultsOnly, Category=Cosmetics)
+	TSoftObjectPtr<UStaticMesh> StaticMesh;
+
+	// Should a skeletal part follow the pose of the skeletal mesh it is attached to instead of animating on its own
+	UPROPERTY(EditDefaultsOnly, Category=Cosmetics)
+	bool bFollowParentPose = true;
+
+	// Should this part be represented by a pooled mesh component instead of spawning the actor
+	UPROPERTY(EditDefaultsOnly, Category=Cosmetics)
+	bool bAllowPooledComponent = true;
+
+private:
+	UPROPERTY(VisibleAnywhere, Category=Cosmetics)
+	TObjectPtr<USkeletalMeshComponent> SkeletalMeshComponent;
+
+	UPROPERTY(VisibleAnywhere, Category=Cosmetics)
+	TObjectPtr<UStaticMeshComponent> StaticMeshComponent;
+};
+
+#undef UE_API
@@ -0,0 +1,143 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LyraCharacterPartPoolSubsystem.h"
+
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(LyraCharacterPartPoolSubsystem)
+
+namespace LyraCharacterPartPool
+{
+	static int32 MaxFreeComponentsPerType = 64;
+	static FAutoConsoleVariableRef CVarMaxFreeComponentsPerType(
+		TEXT("Lyra.CharacterParts.MaxPooledComponents"),
+		MaxFreeComponentsPerType,
+		TEXT("Maximum number of unused skeletal (and, separately, static) mesh components kept for character parts. Extra ones are destroyed on release."),
+		ECVF_Default);
+
+	template <typename ComponentType, typename GetMeshFuncType>
+	ComponentType* TakeFreeComponent(TArray<TObjectPtr<ComponentType>>& FreeComponents, const UObject* MeshAsset, GetMeshFuncType GetMesh)
+	{
+		FreeComponents.RemoveAllSwap([](const TObjectPtr<ComponentType>& Component) { return !IsValid(Component); }, EAllowShrinking::No);
+		if (FreeComponents.IsEmpty())
+		{
+			return nullptr;
+		}
+
+		// Prefer a component that already shows the mesh, so there is no render state to rebuild
+		int32 FoundIndex = FreeComponents.IndexOfByPredicate([&](const TObjectPtr<ComponentType>& Component) { return GetMesh(Component) == MeshAsset; });
+		if (FoundIndex == INDEX_NONE)
+		{
+			FoundIndex = FreeComponents.Num() - 1;
+		}
+
+		ComponentType* Result = FreeComponents[FoundIndex];
+		FreeComponents.RemoveAtSwap(FoundIndex, 1, EAllowShrinking::No);
+		return Result;
+	}
+}
+
+bool ULyraCharacterPartPoolSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void ULyraCharacterPartPoolSubsystem::Deinitialize()
+{
+	// The pool owner is destroyed along with the world, which takes the components with it
+	FreeSkeletalMeshComponents.Reset();
+	FreeStaticMeshComponents.Reset();
+	PoolOwner = nullptr;
+
+	Super::Deinitialize();
+}
+
+AActor* ULyraCharacterPartPoolSubsystem::GetOrCreatePoolOwner()
+{
+	if (!IsValid(PoolOwner))
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.ObjectFlags |= RF_Transient;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+#if WITH_EDITOR
+		SpawnParams.bHideFromSceneOutliner = true;
+#endif
+		PoolOwner = GetWorld()->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+
+		// Old components went away with the previous owner
+		FreeSkeletalMeshComponents.Reset();
+		FreeStaticMeshComponents.Reset();
+	}
+
+	return PoolOwner;
+}
+
+UMeshComponent* ULyraCharacterPartPoolSubsystem::AcquireComponent(bool bSkeletal, const UObject* MeshAsset)
+{
+	UMeshComponent* Result = bSkeletal ?
+		static_cast<UMeshComponent*>(LyraCharacterPartPool::TakeFreeComponent(FreeSkeletalMeshComponents, MeshAsset, [](const USkeletalMeshComponent* Component) { return Component->GetSkeletalMeshAsset(); })) :
+		static_cast<UMeshComponent*>(LyraCharacterPartPool::TakeFreeComponent(FreeStaticMeshComponents, MeshAsset, [](const UStaticMeshComponent* Component) { return Component->GetStaticMesh(); }));
+
+	if (Result == nullptr)
+	{
+		AActor* Owner = GetOrCreatePoolOwner();
+		if (Owner == nullptr)
+		{
+			return nullptr;
+		}
+
+		if (bSkeletal)
+		{
+			Result = NewObject<USkeletalMeshComponent>(Owner, NAME_None, RF_Transient);
+		}
+		else
+		{
+			Result = NewObject<UStaticMeshComponent>(Owner, NAME_None, RF_Transient);
+		}
+		Result->SetVisibility(false);
+		Result->RegisterComponent();
+	}
+
+	return Result;
+}
+
+void ULyraCharacterPartPoolSubsystem::ReleaseComponent(UMeshComponent* Component)
+{
+	if (!IsValid(Component))
+	{
+		return;
+	}
+
+	if (USceneComponent* AttachParent = Component->GetAttachParent())
+	{
+		Component->RemoveTickPrerequisiteComponent(AttachParent);
+	}
+	Component->DetachFromComponent(FDetachmentTransformRules::KeepRelativeTransform);
+	Component->SetVisibility(false);
+	Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Component->EmptyOverrideMaterials();
+
+	if (USkeletalMeshComponent* SkeletalComponent = Cast<USkeletalMeshComponent>(Component))
+	{
+		SkeletalComponent->SetLeaderPoseComponent(nullptr);
+		if (FreeSkeletalMeshComponents.Num() < LyraCharacterPartPool::MaxFreeComponentsPerType)
+		{
+			FreeSkeletalMeshComponents.Add(SkeletalComponent);
+			return;
+		}
+	}
+	else if (UStaticMeshComponent* StaticComponent = Cast<UStaticMeshComponent>(Component))
+	{
+		if (FreeStaticMeshComponents.Num() < LyraCharacterPartPool::MaxFreeComponentsPerType)
+		{
+			FreeStaticMeshComponents.Add(StaticComponent);
+			return;
+		}
+	}
+
+	Component->DestroyComponent();
+}
@@ -0,0 +1,56 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+
+#include "LyraCharacterPartPoolSubsystem.generated.h"
+
+#define UE_API LYRAGAME_API
+
+class AActor;
+class UMeshComponent;
+class UObject;
+class USkeletalMeshComponent;
+class UStaticMeshComponent;
+
+/**
+ * Keeps registered mesh components around for character parts that don't need their own actor
+ *
+ * Pooled components are owned by a single transient actor and attached across to the pawns using them, so they
+ * outlive the pawn and can be handed to the next one on respawn without registering anything again.
+ * Purely cosmetic, so it never exists on dedicated servers.
+ */
+UCLASS(MinimalAPI)
+class ULyraCharacterPartPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~USubsystem interface
+	UE_API virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	UE_API virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	// Returns a registered, hidden and detached mesh component of the requested type, preferring one that already displays MeshAsset
+	UE_API UMeshComponent* AcquireComponent(bool bSkeletal, const UObject* MeshAsset);
+
+	// Detaches a component returned by AcquireComponent and puts it back in the pool, keeping its mesh for the next user
+	UE_API void ReleaseComponent(UMeshComponent* Component);
+
+private:
+	AActor* GetOrCreatePoolOwner();
+
+private:
+	// Owner of every pooled component, never attached to anything
+	UPROPERTY(Transient)
+	TObjectPtr<AActor> PoolOwner;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<USkeletalMeshComponent>> FreeSkeletalMeshComponents;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UStaticMeshComponent>> FreeStaticMeshComponents;
+};
+
+#undef UE_API
@@ -3,9 +3,14 @@
 #include "Cosmetics/LyraPawnComponent_CharacterParts.h"
 
 #include "Components/SkeletalMeshComponent.h"
+#include "Cosmetics/LyraCharacterPartMeshActor.h"
+#include "Cosmetics/LyraCharacterPartPoolSubsystem.h"
 #include "Cosmetics/LyraCharacterPartTypes.h"
+#include "Engine/AssetManager.h"
+#include "Engine/World.h"
 #include "GameFramework/Character.h"
 #include "GameplayTagAssetInterface.h"
+#include "HAL/IConsoleManager.h"
 #include "Net/UnrealNetwork.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(LyraPawnComponent_CharacterParts)
@@ -15,11 +20,36 @@ class UPhysicsAsset;
 class USkeletalMesh;
 class UWorld;
 
+namespace LyraCharacterParts
+{
+	static bool bUsePooledComponents = true;
+	static FAutoConsoleVariableRef CVarUsePooledComponents(
+		TEXT("Lyra.CharacterParts.UsePooledComponents"),
+		bUsePooledComponents,
+		TEXT("Should mesh-only character parts attach pooled mesh components instead of spawning their actor"),
+		ECVF_Default);
+
+	// Returns the class defaults to configure a pooled component from, or nullptr if the part needs its actor spawned
+	static const ALyraCharacterPartMeshActor* GetPooledPartDefaults(const FLyraCharacterPart& Part)
+	{
+		if (bUsePooledComponents && (Part.PartClass != nullptr))
+		{
+			const ALyraCharacterPartMeshActor* PartDefaults = Cast<ALyraCharacterPartMeshActor>(Part.PartClass->GetDefaultObject());
+			if ((PartDefaults != nullptr) && PartDefaults->CanUsePooledComponent())
+			{
+				return PartDefaults;
+			}
+		}
+
+		return nullptr;
+	}
+}
+
 //////////////////////////////////////////////////////////////////////
 
 FString FLyraAppliedCharacterPartEntry::GetDebugString() const
 {
-	return FString::Printf(TEXT("(PartClass: %s, Socket: %s, Instance: %s)"), *GetPathNameSafe(Part.PartClass), *Part.SocketName.ToString(), *GetPathNameSafe(SpawnedComponent));
+	return FString::Printf(TEXT("(PartClass: %s, Socket: %s, Instance: %s)"), *GetPathNameSafe(Part.PartClass), *Part.SocketName.ToString(), (SpawnedComponent != nullptr) ? *GetPathNameSafe(SpawnedComponent) : *GetPathNameSafe(PooledComponent));
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -145,6 +175,14 @@ FGameplayTagContainer FLyraCharacterPartList::CollectCombinedTags() const
 				TagInterface->GetOwnedGameplayTags(/*inout*/ Result);
 			}
 		}
+		else if ((Entry.PooledComponent != nullptr) && (Entry.Part.PartClass != nullptr))
+		{
+			// Pooled parts have no actor, their tags come from the part class defaults
+			if (const ALyraCharacterPartMeshActor* PartDefaults = Cast<ALyraCharacterPartMeshActor>(Entry.Part.PartClass->GetDefaultObject()))
+			{
+				PartDefaults->GetOwnedGameplayTags(/*inout*/ Result);
+			}
+		}
 	}
 
 	return Result;
@@ -162,6 +200,11 @@ bool FLyraCharacterPartList::SpawnActorForEntry(FLyraAppliedCharacterPartEntry&
 
 			if (USceneComponent* ComponentToAttachTo = OwnerComponent->GetSceneComponentToAttachTo())
 			{
+				if (const ALyraCharacterPartMeshActor* PooledPartDefaults = LyraCharacterParts::GetPooledPartDefaults(Entry.Part))
+				{
+					return SpawnPooledComponentForEntry(Entry, *PooledPartDefaults, ComponentToAttachTo);
+				}
+
 				const FTransform SpawnTransform = ComponentToAttachTo->GetSocketTransform(Entry.Part.SocketName);
 
 				UChildActorComponent* PartComponent = NewObject<UChildActorComponent>(OwnerComponent->GetOwner());
@@ -210,9 +253,99 @@ bool FLyraCharacterPartList::DestroyActorForEntry(FLyraAppliedCharacterPartEntry
 		bDestroyedAnyActors = true;
 	}
 
+	if (Entry.MeshLoadHandle.IsValid())
+	{
+		// Make sure a late load doesn't touch the component once it belongs to someone else
+		Entry.MeshLoadHandle->CancelHandle();
+		Entry.MeshLoadHandle.Reset();
+	}
+
+	if (Entry.PooledComponent != nullptr)
+	{
+		ULyraCharacterPartPoolSubsystem* Pool = UWorld::GetSubsystem<ULyraCharacterPartPoolSubsystem>(Entry.PooledComponent->GetWorld());
+		if (Pool != nullptr)
+		{
+			Pool->ReleaseComponent(Entry.PooledComponent);
+		}
+		else
+		{
+			Entry.PooledComponent->DestroyComponent();
+		}
+		Entry.PooledComponent = nullptr;
+		bDestroyedAnyActors = true;
+	}
+
 	return bDestroyedAnyActors;
 }
 
+bool FLyraCharacterPartList::SpawnPooledComponentForEntry(FLyraAppliedCharacterPartEntry& Entry, const ALyraCharacterPartMeshActor& PartDefaults, USceneComponent* ComponentToAttachTo)
+{
+	ULyraCharacterPartPoolSubsystem* Pool = UWorld::GetSubsystem<ULyraCharacterPartPoolSubsystem>(OwnerComponent->GetWorld());
+	if (Pool == nullptr)
+	{
+		return false;
+	}
+
+	const FSoftObjectPath MeshPath = PartDefaults.GetMeshPath();
+	UObject* LoadedMesh = MeshPath.ResolveObject();
+
+	UMeshComponent* PartComponent = Pool->AcquireComponent(PartDefaults.IsSkeletalPart(), LoadedMesh);
+	if (PartComponent == nullptr)
+	{
+		return false;
+	}
+
+	PartComponent->AttachToComponent(ComponentToAttachTo, FAttachmentTransformRules::SnapToTargetIncludingScale, Entry.Part.SocketName);
+	PartComponent->AddTickPrerequisiteComponent(ComponentToAttachTo);
+
+	switch (Entry.Part.CollisionMode)
+	{
+	case ECharacterCustomizationCollisionMode::UseCollisionFromCharacterPart:
+		if (const UMeshComponent* TemplateComponent = PartDefaults.GetTemplateMeshComponent())
+		{
+			PartComponent->SetCollisionObjectType(TemplateComponent->GetCollisionObjectType());
+			PartComponent->SetCollisionResponseToChannels(TemplateComponent->GetCollisionResponseToChannels());
+			PartComponent->SetCollisionEnabled(TemplateComponent->GetCollisionEnabled());
+		}
+		break;
+
+	case ECharacterCustomizationCollisionMode::NoCollision:
+		PartComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		break;
+	}
+
+	Entry.PooledComponent = PartComponent;
+
+	if (LoadedMesh != nullptr)
+	{
+		PartDefaults.ApplyToMeshComponent(PartComponent, ComponentToAttachTo);
+		PartComponent->SetVisibility(true);
+	}
+	else
+	{
+		// Stay hidden until the mesh streams in, then let observers know so they can apply team colors etc.
+		ULyraPawnComponent_CharacterParts* PartsComponent = OwnerComponent;
+		TWeakObjectPtr<UMeshComponent> WeakPartComponent = PartComponent;
+		TWeakObjectPtr<USceneComponent> WeakAttachParent = ComponentToAttachTo;
+		TWeakObjectPtr<const ALyraCharacterPartMeshActor> WeakPartDefaults = &PartDefaults;
+
+		Entry.MeshLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MeshPath, FStreamableDelegate::CreateWeakLambda(PartsComponent,
+			[PartsComponent, WeakPartComponent, WeakAttachParent, WeakPartDefaults]()
+			{
+				UMeshComponent* LoadedPartComponent = WeakPartComponent.Get();
+				const ALyraCharacterPartMeshActor* LoadedPartDefaults = WeakPartDefaults.Get();
+				if ((LoadedPartComponent != nullptr) && (LoadedPartDefaults != nullptr))
+				{
+					LoadedPartDefaults->ApplyToMeshComponent(LoadedPartComponent, WeakAttachParent.Get());
+					LoadedPartComponent->SetVisibility(true);
+					PartsComponent->BroadcastChanged();
+				}
+			}), FStreamableManager::DefaultAsyncLoadPriority, /*bManageActiveHandle=*/ false, /*bStartStalled=*/ false, TEXT("LyraCharacterPart"));
+	}
+
+	return true;
+}
+
 //////////////////////////////////////////////////////////////////////
 
 ULyraPawnComponent_CharacterParts::ULyraPawnComponent_CharacterParts(const FObjectInitializer& ObjectInitializer)
@@ -284,6 +417,21 @@ TArray<AActor*> ULyraPawnComponent_CharacterParts::GetCharacterPartActors() cons
 	return Result;
 }
 
+TArray<UMeshComponent*> ULyraPawnComponent_CharacterParts::GetPooledCharacterPartComponents() const
+{
+	TArray<UMeshComponent*> Result;
+
+	for (const FLyraAppliedCharacterPartEntry& Entry : CharacterPartList.Entries)
+	{
+		if (UMeshComponent* PartComponent = Entry.PooledComponent)
+		{
+			Result.Add(PartComponent);
+		}
+	}
+
+	return Result;
+}
+
 USkeletalMeshComponent* ULyraPawnComponent_CharacterParts::GetParentMeshComponent() const
 {
 	if (AActor* OwnerActor = GetOwner())
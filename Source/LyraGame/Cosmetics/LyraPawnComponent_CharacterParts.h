@@ -15,12 +15,15 @@ struct FGameplayTag;
 struct FLyraCharacterPartList;
 
 class AActor;
+class ALyraCharacterPartMeshActor;
 class UChildActorComponent;
+class UMeshComponent;
 class UObject;
 class USceneComponent;
 class USkeletalMeshComponent;
 struct FFrame;
 struct FNetDeltaSerializeInfo;
+struct FStreamableHandle;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FLyraSpawnedCharacterPartsChanged, ULyraPawnComponent_CharacterParts*, ComponentWithChangedParts);
 
@@ -53,6 +56,13 @@ private:
 	// The spawned actor instance (client only)
 	UPROPERTY(NotReplicated)
 	TObjectPtr<UChildActorComponent> SpawnedComponent = nullptr;
+
+	// The pooled mesh component used instead of an actor for mesh-only parts (client only)
+	UPROPERTY(NotReplicated)
+	TObjectPtr<UMeshComponent> PooledComponent = nullptr;
+
+	// Pending async load of the pooled component's mesh (client only)
+	TSharedPtr<FStreamableHandle> MeshLoadHandle;
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -97,6 +107,8 @@ private:
 	bool SpawnActorForEntry(FLyraAppliedCharacterPartEntry& Entry);
 	bool DestroyActorForEntry(FLyraAppliedCharacterPartEntry& Entry);
 
+	bool SpawnPooledComponentForEntry(FLyraAppliedCharacterPartEntry& Entry, const ALyraCharacterPartMeshActor& PartDefaults, USceneComponent* ComponentToAttachTo);
+
 private:
 	// Replicated list of equipment entries
 	UPROPERTY()
@@ -149,6 +161,10 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure=false, BlueprintCosmetic, Category=Cosmetics)
 	TArray<AActor*> GetCharacterPartActors() const;
 
+	// Gets the mesh components attached directly for mesh-only parts, which don't show up in GetCharacterPartActors
+	UFUNCTION(BlueprintCallable, BlueprintPure=false, BlueprintCosmetic, Category=Cosmetics)
+	TArray<UMeshComponent*> GetPooledCharacterPartComponents() const;
+
 	// If the parent actor is derived from ACharacter, returns the Mesh component, otherwise nullptr
 	USkeletalMeshComponent* GetParentMeshComponent() const;
 
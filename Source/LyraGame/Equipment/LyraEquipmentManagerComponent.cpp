@@ -4,7 +4,6 @@
 
 #include "AbilitySystem/LyraAbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
-#include "Engine/ActorChannel.h"
 #include "LyraEquipmentDefinition.h"
 #include "LyraEquipmentInstance.h"
 #include "Net/UnrealNetwork.h"
@@ -12,7 +11,6 @@
 #include UE_INLINE_GENERATED_CPP_BY_NAME(LyraEquipmentManagerComponent)
 
 class FLifetimeProperty;
-struct FReplicationFlags;
 
 //////////////////////////////////////////////////////////////////////
 // FLyraAppliedEquipmentEntry
@@ -35,10 +33,15 @@ void FLyraEquipmentList::PreReplicatedRemove(const TArrayView<int32> RemovedIndi
 			Entry.Instance->OnUnequipped();
 		}
  	}
+
+	// Rebuilt once the entries are actually gone, see PostReplicatedReceive
+	InvalidateInstanceIndex();
 }
 
 void FLyraEquipmentList::PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize)
 {
+	InvalidateInstanceIndex();
+
 	for (int32 Index : AddedIndices)
 	{
 		const FLyraAppliedEquipmentEntry& Entry = Entries[Index];
@@ -58,6 +61,39 @@ void FLyraEquipmentList::PostReplicatedChange(const TArrayView<int32> ChangedInd
 // 	}
 }
 
+void FLyraEquipmentList::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+	// Covers removed entries and instances that were only just mapped
+	InvalidateInstanceIndex();
+}
+
+TConstArrayView<ULyraEquipmentInstance*> FLyraEquipmentList::GetInstancesOfType(TSubclassOf<ULyraEquipmentInstance> InstanceType) const
+{
+	if (InstanceType == nullptr)
+	{
+		return TConstArrayView<ULyraEquipmentInstance*>();
+	}
+
+	if (const TArray<ULyraEquipmentInstance*>* CachedInstances = InstancesByType.Find(InstanceType.Get()))
+	{
+		return *CachedInstances;
+	}
+
+	TArray<ULyraEquipmentInstance*>& Instances = InstancesByType.Add(InstanceType.Get());
+	for (const FLyraAppliedEquipmentEntry& Entry : Entries)
+	{
+		if (ULyraEquipmentInstance* Instance = Entry.Instance)
+		{
+			if (Instance->IsA(InstanceType))
+			{
+				Instances.Add(Instance);
+			}
+		}
+	}
+
+	return Instances;
+}
+
 ULyraAbilitySystemComponent* FLyraEquipmentList::GetAbilitySystemComponent() const
 {
 	check(OwnerComponent);
@@ -102,6 +138,7 @@ ULyraEquipmentInstance* FLyraEquipmentList::AddEntry(TSubclassOf<ULyraEquipmentD
 
 
 	MarkItemDirty(NewEntry);
+	InvalidateInstanceIndex();
 
 	return Result;
 }
@@ -123,6 +160,7 @@ void FLyraEquipmentList::RemoveEntry(ULyraEquipmentInstance* Instance)
 
 			EntryIt.RemoveCurrent();
 			MarkArrayDirty();
+			InvalidateInstanceIndex();
 		}
 	}
 }
@@ -136,6 +174,9 @@ ULyraEquipmentManagerComponent::ULyraEquipmentManagerComponent(const FObjectInit
 {
 	SetIsReplicatedByDefault(true);
 	bWantsInitializeComponent = true;
+
+	// Equipment instances are registered as they are equipped instead of being walked in ReplicateSubobjects
+	bReplicateUsingRegisteredSubObjectList = true;
 }
 
 void ULyraEquipmentManagerComponent::GetLifetimeReplicatedProps(TArray< FLifetimeProperty >& OutLifetimeProps) const
@@ -178,23 +219,6 @@ void ULyraEquipmentManagerComponent::UnequipItem(ULyraEquipmentInstance* ItemIns
 	}
 }
 
-bool ULyraEquipmentManagerComponent::ReplicateSubobjects(UActorChannel* Channel, class FOutBunch* Bunch, FReplicationFlags* RepFlags)
-{
-	bool WroteSomething = Super::ReplicateSubobjects(Channel, Bunch, RepFlags);
-
-	for (FLyraAppliedEquipmentEntry& Entry : EquipmentList.Entries)
-	{
-		ULyraEquipmentInstance* Instance = Entry.Instance;
-
-		if (IsValid(Instance))
-		{
-			WroteSomething |= Channel->ReplicateSubobject(Instance, *Bunch, *RepFlags);
-		}
-	}
-
-	return WroteSomething;
-}
-
 void ULyraEquipmentManagerComponent::InitializeComponent()
 {
 	Super::InitializeComponent();
@@ -239,34 +263,17 @@ void ULyraEquipmentManagerComponent::ReadyForReplication()
 
 ULyraEquipmentInstance* ULyraEquipmentManagerComponent::GetFirstInstanceOfType(TSubclassOf<ULyraEquipmentInstance> InstanceType)
 {
-	for (FLyraAppliedEquipmentEntry& Entry : EquipmentList.Entries)
-	{
-		if (ULyraEquipmentInstance* Instance = Entry.Instance)
-		{
-			if (Instance->IsA(InstanceType))
-			{
-				return Instance;
-			}
-		}
-	}
-
-	return nullptr;
+	TConstArrayView<ULyraEquipmentInstance*> Instances = EquipmentList.GetInstancesOfType(InstanceType);
+	return Instances.IsEmpty() ? nullptr : Instances[0];
 }
 
 TArray<ULyraEquipmentInstance*> ULyraEquipmentManagerComponent::GetEquipmentInstancesOfType(TSubclassOf<ULyraEquipmentInstance> InstanceType) const
 {
-	TArray<ULyraEquipmentInstance*> Results;
-	for (const FLyraAppliedEquipmentEntry& Entry : EquipmentList.Entries)
-	{
-		if (ULyraEquipmentInstance* Instance = Entry.Instance)
-		{
-			if (Instance->IsA(InstanceType))
-			{
-				Results.Add(Instance);
-			}
-		}
-	}
-	return Results;
+	return TArray<ULyraEquipmentInstance*>(EquipmentList.GetInstancesOfType(InstanceType));
 }
 
+TConstArrayView<ULyraEquipmentInstance*> ULyraEquipmentManagerComponent::GetEquipmentInstancesOfTypeView(TSubclassOf<ULyraEquipmentInstance> InstanceType) const
+{
+	return EquipmentList.GetInstancesOfType(InstanceType);
+}
 
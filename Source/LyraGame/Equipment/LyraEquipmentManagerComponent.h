@@ -5,6 +5,7 @@
 #include "AbilitySystem/LyraAbilitySet.h"
 #include "Components/PawnComponent.h"
 #include "Net/Serialization/FastArraySerializer.h"
+#include "UObject/ObjectKey.h"
 
 #include "LyraEquipmentManagerComponent.generated.h"
 
@@ -19,7 +20,6 @@ class UObject;
 struct FFrame;
 struct FLyraEquipmentList;
 struct FNetDeltaSerializeInfo;
-struct FReplicationFlags;
 
 /** A single piece of applied equipment */
 USTRUCT(BlueprintType)
@@ -69,6 +69,7 @@ public:
 	void PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize);
 	void PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize);
 	void PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize);
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
 	//~End of FFastArraySerializer contract
 
 	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
@@ -79,9 +80,14 @@ public:
 	ULyraEquipmentInstance* AddEntry(TSubclassOf<ULyraEquipmentDefinition> EquipmentDefinition);
 	void RemoveEntry(ULyraEquipmentInstance* Instance);
 
+	/** Equipped instances of a type in equip order, cached until the list changes. The view is valid until then too. */
+	TConstArrayView<ULyraEquipmentInstance*> GetInstancesOfType(TSubclassOf<ULyraEquipmentInstance> InstanceType) const;
+
 private:
 	ULyraAbilitySystemComponent* GetAbilitySystemComponent() const;
 
+	void InvalidateInstanceIndex() { InstancesByType.Reset(); }
+
 	friend ULyraEquipmentManagerComponent;
 
 private:
@@ -91,6 +97,9 @@ private:
 
 	UPROPERTY(NotReplicated)
 	TObjectPtr<UActorComponent> OwnerComponent;
+
+	// Results of GetInstancesOfType keyed by the queried instance class, the instances are kept alive by Entries
+	mutable TMap<TObjectKey<UClass>, TArray<ULyraEquipmentInstance*>> InstancesByType;
 };
 
 template<>
@@ -125,10 +134,6 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly)
 	UE_API void UnequipItem(ULyraEquipmentInstance* ItemInstance);
 
-	//~UObject interface
-	UE_API virtual bool ReplicateSubobjects(class UActorChannel* Channel, class FOutBunch* Bunch, FReplicationFlags* RepFlags) override;
-	//~End of UObject interface
-
 	//~UActorComponent interface
 	//virtual void EndPlay() override;
 	UE_API virtual void InitializeComponent() override;
@@ -144,6 +149,9 @@ public:
  	UFUNCTION(BlueprintCallable, BlueprintPure)
 	UE_API TArray<ULyraEquipmentInstance*> GetEquipmentInstancesOfType(TSubclassOf<ULyraEquipmentInstance> InstanceType) const;
 
+	/** Same as GetEquipmentInstancesOfType without copying, valid until the equipment changes */
+	UE_API TConstArrayView<ULyraEquipmentInstance*> GetEquipmentInstancesOfTypeView(TSubclassOf<ULyraEquipmentInstance> InstanceType) const;
+
 	template <typename T>
 	T* GetFirstInstanceOfType()
 	{
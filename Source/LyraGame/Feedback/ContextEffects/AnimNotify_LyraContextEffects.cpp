@@ -10,6 +10,7 @@
 #include "NiagaraFunctionLibrary.h"
 #include "Kismet/GameplayStatics.h"
 #include "NiagaraSystem.h"
+#include "System/LyraSignificanceManager.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AnimNotify_LyraContextEffects)
 
@@ -52,6 +53,12 @@ void UAnimNotify_LyraContextEffects::Notify(USkeletalMeshComponent* MeshComp, UA
 		// Make sure both MeshComp and Owning Actor is valid
 		if (AActor* OwningActor = MeshComp->GetOwner())
 		{
+			// Nobody is near or looking at the owner, skip the trace and the effects
+			if (ULyraSignificanceManager::GetActorSignificanceLevel(OwningActor) == ELyraSignificanceLevel::Lowest)
+			{
+				return;
+			}
+
 			// Prepare Trace Data
 			bool bHitSuccess = false;
 			FHitResult HitResult;
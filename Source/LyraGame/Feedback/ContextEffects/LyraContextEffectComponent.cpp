@@ -23,6 +23,12 @@ ULyraContextEffectComponent::ULyraContextEffectComponent()
 	// ...
 }
 
+bool ULyraContextEffectComponent::NeedsLoadForServer() const
+{
+	// Context effects are purely cosmetic
+	return false;
+}
+
 
 // Called when the game starts
 void ULyraContextEffectComponent::BeginPlay()
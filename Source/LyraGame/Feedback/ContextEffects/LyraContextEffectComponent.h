@@ -4,6 +4,7 @@
 
 #include "Components/ActorComponent.h"
 #include "LyraContextEffectsInterface.h"
+#include "System/LyraClientOnlyComponentInterface.h"
 
 #include "LyraContextEffectComponent.generated.h"
 
@@ -21,7 +22,7 @@ struct FFrame;
 struct FHitResult;
 
 UCLASS(MinimalAPI,  ClassGroup=(Custom), hidecategories = (Variable, Tags, ComponentTick, ComponentReplication, Activation, Cooking, AssetUserData, Collision), CollapseCategories, meta=(BlueprintSpawnableComponent) )
-class ULyraContextEffectComponent : public UActorComponent, public ILyraContextEffectsInterface
+class ULyraContextEffectComponent : public UActorComponent, public ILyraContextEffectsInterface, public ILyraClientOnlyComponentInterface
 {
 	GENERATED_BODY()
 
@@ -29,6 +30,10 @@ public:
 	// Sets default values for this component's properties
 	UE_API ULyraContextEffectComponent();
 
+	//~UObject interface
+	UE_API virtual bool NeedsLoadForServer() const override;
+	//~End of UObject interface
+
 protected:
 	// Called when the game starts
 	UE_API virtual void BeginPlay() override;
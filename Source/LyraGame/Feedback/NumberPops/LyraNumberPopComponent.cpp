@@ -9,3 +9,9 @@ ULyraNumberPopComponent::ULyraNumberPopComponent(const FObjectInitializer& Objec
 {
 }
 
+bool ULyraNumberPopComponent::NeedsLoadForServer() const
+{
+	// Number pops are only ever shown to local players
+	return false;
+}
+
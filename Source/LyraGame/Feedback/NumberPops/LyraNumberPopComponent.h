@@ -4,6 +4,7 @@
 
 #include "Components/ControllerComponent.h"
 #include "GameplayTagContainer.h"
+#include "System/LyraClientOnlyComponentInterface.h"
 
 #include "LyraNumberPopComponent.generated.h"
 
@@ -43,7 +44,7 @@ struct FLyraNumberPopRequest
 
 
 UCLASS(Abstract)
-class ULyraNumberPopComponent : public UControllerComponent
+class ULyraNumberPopComponent : public UControllerComponent, public ILyraClientOnlyComponentInterface
 {
 	GENERATED_BODY()
 
@@ -51,6 +52,10 @@ public:
 
 	ULyraNumberPopComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
+	//~UObject interface
+	virtual bool NeedsLoadForServer() const override;
+	//~End of UObject interface
+
 	/** Adds a damage number to the damage number list for visualization */
 	UFUNCTION(BlueprintCallable, Category = Foo)
 	virtual void AddNumberPop(const FLyraNumberPopRequest& NewRequest) {}
@@ -2,6 +2,8 @@
 
 #include "LyraNumberPopComponent_MeshText.h"
 
+#include "Algo/Reverse.h"
+#include "Components/InstancedStaticMeshComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Engine/CollisionProfile.h"
 #include "Engine/Engine.h"
@@ -54,40 +56,69 @@ void ULyraNumberPopComponent_MeshText::AddNumberPop(const FLyraNumberPopRequest&
 		}
 	}
 
+	UStaticMesh* MeshToUse = DetermineStaticMesh(NewRequest);
+	if (MeshToUse == nullptr)
+	{
+		return;
+	}
+
 	FTempNumberPopInfo PreparedNumberInfo;
 
 	// Prepare the DamageNumberArray with the digits from the damage.
 	{
 		int32 LocalDamage = NewRequest.NumberToDisplay;
-		PreparedNumberInfo.DamageNumberArray.Empty();
+		TArray<int32>& DamageNumberArray = PreparedNumberInfo.DamageNumberArray;
+		DamageNumberArray.Reset();
 
 		if (LocalDamage == 0)
 		{
 			// We want to just show a zero
-			PreparedNumberInfo.DamageNumberArray.Insert(0, 0);
+			DamageNumberArray.Add(0);
 		}
 		else
 		{
-			// Parse the base10 number into an array
+			// Parse the base10 number into an array, least significant digit first
 			while (LocalDamage > 0)
 			{
-				PreparedNumberInfo.DamageNumberArray.Insert(LocalDamage % 10, 0);
+				DamageNumberArray.Add(LocalDamage % 10);
 				LocalDamage /= 10;
 			}
 		}
 
-		// Insert a zero to reserve space for + or -. Used by the blueprint
-		PreparedNumberInfo.DamageNumberArray.Insert(0, 0);
+		// Add a zero to reserve space for + or -. Used by the blueprint
+		DamageNumberArray.Add(0);
+
+		// Flip it around so the sign comes first, followed by the most significant digit
+		Algo::Reverse(DamageNumberArray);
 	}
 
-	// Grab a component from the pool for this number or create one
+	// Determine the position
+	FTransform CameraTransform;
+	FVector NumberLocation(NewRequest.WorldLocation);
+	if (APlayerController* PC = GetController<APlayerController>())
 	{
-		UStaticMesh* MeshToUse = DetermineStaticMesh(NewRequest);
-		if (MeshToUse == nullptr)
+		if (APlayerCameraManager* PlayerCameraManager = PC->PlayerCameraManager)
 		{
-			return;
+			CameraTransform = FTransform(PlayerCameraManager->GetCameraRotation(), PlayerCameraManager->GetCameraLocation());
+
+			FVector LocationOffset(ForceInitToZero);
+
+			const float RandomMagnitude = 5.0f; //@TODO: Make this style driven
+			LocationOffset += FMath::RandPointInBox(FBox(FVector(-RandomMagnitude), FVector(RandomMagnitude)));
+
+			NumberLocation += LocationOffset;
 		}
+	}
+
+	if (bUseInstancedMeshes)
+	{
+		// Skip the sign slot, the instanced material doesn't draw it
+		AddInstancedNumberPop(NewRequest, MakeArrayView(PreparedNumberInfo.DamageNumberArray).RightChop(1), MeshToUse, CameraTransform, NumberLocation);
+		return;
+	}
 
+	// Grab a component from the pool for this number or create one
+	{
 		FPooledNumberPopComponentList& ComponentPool = PooledComponentMap.FindOrAdd(MeshToUse);
 
 		UStaticMeshComponent* ComponentToUse = nullptr;
@@ -134,34 +165,100 @@ void ULyraNumberPopComponent_MeshText::AddNumberPop(const FLyraNumberPopRequest&
 			PreparedNumberInfo.MeshMIDs.Add(NewMID);
 		}
 
-		// Start the timer if it wasn't already running
-		if (!LocalWorld->GetTimerManager().IsTimerActive(ReleaseTimerHandle))
-		{
-			LocalWorld->GetTimerManager().SetTimer(ReleaseTimerHandle, this, &ThisClass::ReleaseNextComponents, ComponentLifespan);
-		}
+		StartReleaseTimer();
 	}
 
-	// Determine the position
-	FTransform CameraTransform;
-	FVector NumberLocation(NewRequest.WorldLocation);
-	if (APlayerController* PC = GetController<APlayerController>())
+	PreparedNumberInfo.StaticMeshComponent->SetWorldTransform(FTransform(CameraTransform.GetRotation(), NumberLocation));
+
+	// Now apply the material parameters to make the digits, etc...
+	SetMaterialParameters(NewRequest, PreparedNumberInfo, CameraTransform, NumberLocation);
+}
+
+void ULyraNumberPopComponent_MeshText::AddInstancedNumberPop(const FLyraNumberPopRequest& Request, TConstArrayView<int32> Digits, UStaticMesh* MeshToUse, const FTransform& CameraTransform, const FVector& NumberLocation)
+{
+	UWorld* LocalWorld = GetWorld();
+	check(LocalWorld);
+
+	FNumberPopInstancedMesh& InstancedMesh = InstancedMeshMap.FindOrAdd(MeshToUse);
+	UInstancedStaticMeshComponent* InstancedComponent = GetOrCreateInstancedComponent(MeshToUse, InstancedMesh);
+	if (InstancedComponent == nullptr)
 	{
-		if (APlayerCameraManager* PlayerCameraManager = PC->PlayerCameraManager)
-		{
-			CameraTransform = FTransform(PlayerCameraManager->GetCameraRotation(), PlayerCameraManager->GetCameraLocation());
+		return;
+	}
 
-			FVector LocationOffset(ForceInitToZero);
+	const float DistanceFromCameraToNumber = (CameraTransform.GetLocation() - NumberLocation).Size();
+	const float DistanceSpriteScale = DistanceFromCameraBeforeDoublingSize == 0.f ? 1.f : FMath::Clamp(DistanceFromCameraToNumber / DistanceFromCameraBeforeDoublingSize, 1.f, 1000000000.f);
+	const float HitSizeMultiplier = Request.bIsCriticalDamage ? CriticalHitSizeMultiplier : 1.f;
+	const FLinearColor Color = DetermineColor(Request);
+
+	float CustomData[LyraNumberPopInstanceData::NumCustomDataFloats] = {};
+	CustomData[LyraNumberPopInstanceData::ColorR] = Color.R;
+	CustomData[LyraNumberPopInstanceData::ColorG] = Color.G;
+	CustomData[LyraNumberPopInstanceData::ColorB] = Color.B;
+	CustomData[LyraNumberPopInstanceData::EndTime] = LocalWorld->GetTimeSeconds() + ComponentLifespan;
+	CustomData[LyraNumberPopInstanceData::RandomSeed] = FMath::FRand();
+	CustomData[LyraNumberPopInstanceData::IsCriticalHit] = Request.bIsCriticalDamage ? 1.f : 0.f;
+	CustomData[LyraNumberPopInstanceData::DigitSizeX] = FontXSize * HitSizeMultiplier * DistanceSpriteScale;
+	CustomData[LyraNumberPopInstanceData::DigitSizeY] = FontYSize * HitSizeMultiplier * DistanceSpriteScale;
+
+	// IF the damage number has more digits than we support
+	// THEN show the largest number we can support
+	const bool bTooManyDigits = Digits.Num() > LyraNumberPopInstanceData::MaxDigits;
+	const int32 NumDigits = FMath::Min(Digits.Num(), LyraNumberPopInstanceData::MaxDigits);
+	CustomData[LyraNumberPopInstanceData::NumDigits] = NumDigits;
+	for (int32 DigitIndex = 0; DigitIndex < NumDigits; ++DigitIndex)
+	{
+		CustomData[LyraNumberPopInstanceData::FirstDigit + DigitIndex] = bTooManyDigits ? 9.f : Digits[DigitIndex];
+	}
 
-			const float RandomMagnitude = 5.0f; //@TODO: Make this style driven
-			LocationOffset += FMath::RandPointInBox(FBox(FVector(-RandomMagnitude), FVector(RandomMagnitude)));
+	const int32 InstanceIndex = InstancedComponent->AddInstance(FTransform(CameraTransform.GetRotation(), NumberLocation), /*bWorldSpace=*/ true);
+	InstancedComponent->SetCustomData(InstanceIndex, MakeArrayView(CustomData), /*bMarkRenderStateDirty=*/ true);
 
-			NumberLocation += LocationOffset;
-		}
+	InstancedMesh.ReleaseTimes.Add(LocalWorld->GetTimeSeconds() + ComponentLifespan);
+
+	StartReleaseTimer();
+}
+
+UInstancedStaticMeshComponent* ULyraNumberPopComponent_MeshText::GetOrCreateInstancedComponent(UStaticMesh* MeshToUse, FNumberPopInstancedMesh& InstancedMesh)
+{
+	if (InstancedMesh.Component == nullptr)
+	{
+		UInstancedStaticMeshComponent* NewComponent = NewObject<UInstancedStaticMeshComponent>(GetOwner());
+		NewComponent->SetupAttachment(nullptr);
+		NewComponent->SetCollisionProfileName(UCollisionProfile::NoCollision_ProfileName);
+		NewComponent->SetStaticMesh(MeshToUse);
+		NewComponent->NumCustomDataFloats = LyraNumberPopInstanceData::NumCustomDataFloats;
+
+		// Used to allow post-processes to opt out of affecting the number pop digits
+		NewComponent->SetRenderCustomDepth(true);
+		NewComponent->SetCustomDepthStencilValue(123);
+
+		// The digits travel a great distance from their original bounds due to
+		// world position offset (WPO) animation in the material, so expand bounds
+		NewComponent->SetBoundsScale(2000.0f);
+
+		NewComponent->RegisterComponent();
+
+		// Parameters that are the same for every pop only need to be set once
+		//@TODO: Determine whether or not we are spectating
+		const bool bIsSpectating = false;
+		NewComponent->SetScalarParameterValueOnMaterials(AnimationLifespanParameterName, ComponentLifespan);
+		NewComponent->SetScalarParameterValueOnMaterials(MoveToCameraParameterName, bIsSpectating ? 0.0f : 1.0f);
+
+		InstancedMesh.Component = NewComponent;
 	}
-	PreparedNumberInfo.StaticMeshComponent->SetWorldTransform(FTransform(CameraTransform.GetRotation(), NumberLocation));
 
-	// Now apply the material parameters to make the digits, etc...
-	SetMaterialParameters(NewRequest, PreparedNumberInfo, CameraTransform, NumberLocation);
+	return InstancedMesh.Component;
+}
+
+void ULyraNumberPopComponent_MeshText::StartReleaseTimer()
+{
+	// Start the timer if it wasn't already running, every pop lives for the same time so the oldest one is always released first
+	FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+	if (!TimerManager.IsTimerActive(ReleaseTimerHandle))
+	{
+		TimerManager.SetTimer(ReleaseTimerHandle, this, &ThisClass::ReleaseNextComponents, ComponentLifespan);
+	}
 }
 
 void ULyraNumberPopComponent_MeshText::ReleaseNextComponents()
@@ -204,10 +301,51 @@ void ULyraNumberPopComponent_MeshText::ReleaseNextComponents()
 	// Actually remove it from the live components array
 	LiveComponents.RemoveAt(0, NumReleased);
 
-	// If we still have live components animating, set the timer to remove the next one
-	if (LiveComponents.Num() > 0)
+	float NextReleaseTime = (LiveComponents.Num() > 0) ? LiveComponents[0].ReleaseTime : TNumericLimits<float>::Max();
+
+	// Instances are in chronological order as well, so expired ones are always at the front
+	for (TPair<TObjectPtr<UStaticMesh>, FNumberPopInstancedMesh>& Pair : InstancedMeshMap)
+	{
+		FNumberPopInstancedMesh& InstancedMesh = Pair.Value;
+
+		int32 NumExpired = 0;
+		while ((NumExpired < InstancedMesh.ReleaseTimes.Num()) && (CurrentTime >= InstancedMesh.ReleaseTimes[NumExpired]))
+		{
+			++NumExpired;
+		}
+
+		if (NumExpired > 0)
+		{
+			if (ensure(InstancedMesh.Component))
+			{
+				if (NumExpired == InstancedMesh.Component->GetInstanceCount())
+				{
+					InstancedMesh.Component->ClearInstances();
+				}
+				else
+				{
+					TArray<int32> InstancesToRemove;
+					InstancesToRemove.Reserve(NumExpired);
+					for (int32 InstanceIndex = 0; InstanceIndex < NumExpired; ++InstanceIndex)
+					{
+						InstancesToRemove.Add(InstanceIndex);
+					}
+					InstancedMesh.Component->RemoveInstances(InstancesToRemove);
+				}
+			}
+			InstancedMesh.ReleaseTimes.RemoveAt(0, NumExpired, EAllowShrinking::No);
+		}
+
+		if (InstancedMesh.ReleaseTimes.Num() > 0)
+		{
+			NextReleaseTime = FMath::Min(NextReleaseTime, InstancedMesh.ReleaseTimes[0]);
+		}
+	}
+
+	// If we still have live components or instances animating, set the timer to remove the next one
+	if (NextReleaseTime < TNumericLimits<float>::Max())
 	{
-		const float TimeUntilNextRelease = LiveComponents[0].ReleaseTime - CurrentTime;
+		const float TimeUntilNextRelease = FMath::Max(NextReleaseTime - CurrentTime, UE_KINDA_SMALL_NUMBER);
 		LocalWorld->GetTimerManager().SetTimer(ReleaseTimerHandle, this, &ThisClass::ReleaseNextComponents, TimeUntilNextRelease);
 	}
 }
@@ -7,6 +7,7 @@
 #include "LyraNumberPopComponent_MeshText.generated.h"
 
 class ULyraDamagePopStyle;
+class UInstancedStaticMeshComponent;
 class UMaterialInstanceDynamic;
 class UObject;
 class UStaticMesh;
@@ -44,6 +45,53 @@ struct FLiveNumberPopEntry
 	{}
 };
 
+/**
+ * Per-instance custom data written for every pop drawn through an instanced mesh.
+ * The text mesh material has to read these instead of the per-digit MID parameters.
+ */
+namespace LyraNumberPopInstanceData
+{
+	// Linear color of the digits
+	constexpr int32 ColorR = 0;
+	constexpr int32 ColorG = 1;
+	constexpr int32 ColorB = 2;
+
+	// World time in seconds at which the pop finishes animating, the same clock as the material Time node and ReleaseTimes
+	constexpr int32 EndTime = 3;
+
+	// Random value in [0, 1] for per-pop animation variation
+	constexpr int32 RandomSeed = 4;
+
+	// 1 for critical hits, 0 otherwise
+	constexpr int32 IsCriticalHit = 5;
+
+	// Size of a single digit, already scaled for distance and critical hits
+	constexpr int32 DigitSizeX = 6;
+	constexpr int32 DigitSizeY = 7;
+
+	// Number of digits that follow
+	constexpr int32 NumDigits = 8;
+
+	// Digits of the number, most significant first
+	constexpr int32 FirstDigit = 9;
+	constexpr int32 MaxDigits = 8;
+
+	constexpr int32 NumCustomDataFloats = FirstDigit + MaxDigits;
+}
+
+/** Instanced mesh drawing every live pop of one text mesh */
+USTRUCT()
+struct FNumberPopInstancedMesh
+{
+	GENERATED_BODY()
+
+	UPROPERTY(transient)
+	TObjectPtr<UInstancedStaticMeshComponent> Component = nullptr;
+
+	/** World time each instance will be removed at, in instance order (which is also chronological) */
+	TArray<float> ReleaseTimes;
+};
+
 /** Struct that holds the info for a new damage number */
 struct FTempNumberPopInfo
 {
@@ -73,11 +121,18 @@ public:
 protected:
 	void SetMaterialParameters(const FLyraNumberPopRequest& Request, FTempNumberPopInfo& NewDamageNumberInfo, const FTransform& CameraTransform, const FVector& NumberLocation);
 
+	/** Appends the pop as one instance of the instanced mesh for MeshToUse */
+	void AddInstancedNumberPop(const FLyraNumberPopRequest& Request, TConstArrayView<int32> Digits, UStaticMesh* MeshToUse, const FTransform& CameraTransform, const FVector& NumberLocation);
+
+	UInstancedStaticMeshComponent* GetOrCreateInstancedComponent(UStaticMesh* MeshToUse, FNumberPopInstancedMesh& InstancedMesh);
+
+	void StartReleaseTimer();
+
 	FLinearColor DetermineColor(const FLyraNumberPopRequest& Request) const;
 	UStaticMesh* DetermineStaticMesh(const FLyraNumberPopRequest& Request) const;
 
 
-	/** Releases components back to the pool that have exceeded their lifespan */
+	/** Releases components back to the pool and removes instances that have exceeded their lifespan */
 	void ReleaseNextComponents();
 
 	/** Style patterns to attempt to apply to the incoming number pops */
@@ -87,6 +142,13 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Number Pop|Style")
 	float ComponentLifespan;
 
+	/**
+	 * Draws all pops sharing a text mesh from a single instanced mesh instead of one pooled component with its own MIDs per pop.
+	 * The text mesh materials must read the pop from per-instance custom data, see LyraNumberPopInstanceData.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Number Pop|Style")
+	bool bUseInstancedMeshes = false;
+
 	UPROPERTY(EditDefaultsOnly, Category = "Number Pop|Style")
 	float DistanceFromCameraBeforeDoublingSize;
 	
@@ -136,5 +198,8 @@ protected:
 	UPROPERTY(transient)
 	TArray<FLiveNumberPopEntry> LiveComponents;
 
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UStaticMesh>, FNumberPopInstancedMesh> InstancedMeshMap;
+
 	FTimerHandle ReleaseTimerHandle;
 };
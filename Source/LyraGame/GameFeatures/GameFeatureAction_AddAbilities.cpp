@@ -4,6 +4,9 @@
 #include "Engine/GameInstance.h"
 #include "Components/GameFrameworkComponentManager.h"
 #include "AbilitySystem/LyraAbilitySystemComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/DataTable.h"
+#include "Engine/StreamableManager.h"
 #include "Engine/World.h"
 #include "Player/LyraPlayerState.h" //@TODO: For the fname
 #include "GameFeatures/GameFeatureAction_WorldActionBase.h"
@@ -28,6 +31,10 @@ void UGameFeatureAction_AddAbilities::OnGameFeatureActivating(FGameFeatureActiva
 	{
 		Reset(ActiveData);
 	}
+
+	// Resolve everything up front, so actors receiving the extension later never load anything themselves
+	StartPreload(ActiveData, Context);
+
 	Super::OnGameFeatureActivating(Context);
 }
 
@@ -137,6 +144,173 @@ void UGameFeatureAction_AddAbilities::Reset(FPerContextData& ActiveData)
 	}
 
 	ActiveData.ComponentRequests.Empty();
+	ActiveData.PendingActors.Empty();
+
+	if (ActiveData.PreloadHandle.IsValid())
+	{
+		ActiveData.PreloadHandle->CancelHandle();
+		ActiveData.PreloadHandle.Reset();
+	}
+	ActiveData.ResolvedEntries.Empty();
+	ActiveData.bPreloadComplete = false;
+}
+
+void UGameFeatureAction_AddAbilities::StartPreload(FPerContextData& ActiveData, const FGameFeatureStateChangeContext& ChangeContext)
+{
+	TArray<FSoftObjectPath> AssetsToLoad;
+	for (const FGameFeatureAbilitiesEntry& Entry : AbilitiesList)
+	{
+		for (const FLyraAbilityGrant& Ability : Entry.GrantedAbilities)
+		{
+			if (!Ability.AbilityType.IsNull())
+			{
+				AssetsToLoad.AddUnique(Ability.AbilityType.ToSoftObjectPath());
+			}
+		}
+
+		for (const FLyraAttributeSetGrant& Attributes : Entry.GrantedAttributes)
+		{
+			if (!Attributes.AttributeSetType.IsNull())
+			{
+				AssetsToLoad.AddUnique(Attributes.AttributeSetType.ToSoftObjectPath());
+			}
+			if (!Attributes.InitializationData.IsNull())
+			{
+				AssetsToLoad.AddUnique(Attributes.InitializationData.ToSoftObjectPath());
+			}
+		}
+
+		for (const TSoftObjectPtr<const ULyraAbilitySet>& SetPtr : Entry.GrantedAbilitySets)
+		{
+			if (!SetPtr.IsNull())
+			{
+				AssetsToLoad.AddUnique(SetPtr.ToSoftObjectPath());
+			}
+		}
+	}
+
+	if (!AssetsToLoad.IsEmpty())
+	{
+		ActiveData.PreloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(AssetsToLoad,
+			FStreamableDelegate::CreateUObject(this, &ThisClass::OnPreloadComplete, FGameFeatureStateChangeContext(ChangeContext)));
+	}
+
+	// Nothing to wait for if the request was not needed or everything was already in memory
+	if (!ActiveData.bPreloadComplete && (!ActiveData.PreloadHandle.IsValid() || ActiveData.PreloadHandle->HasLoadCompleted()))
+	{
+		ResolveEntries(ActiveData);
+		ActiveData.bPreloadComplete = true;
+	}
+}
+
+void UGameFeatureAction_AddAbilities::OnPreloadComplete(FGameFeatureStateChangeContext ChangeContext)
+{
+	FPerContextData* ActiveData = ContextData.Find(ChangeContext);
+	if ((ActiveData == nullptr) || ActiveData->bPreloadComplete)
+	{
+		return;
+	}
+
+	ResolveEntries(*ActiveData);
+	ActiveData->bPreloadComplete = true;
+
+	TArray<TPair<TWeakObjectPtr<AActor>, int32>> PendingActors = MoveTemp(ActiveData->PendingActors);
+	for (const TPair<TWeakObjectPtr<AActor>, int32>& Pending : PendingActors)
+	{
+		if (AActor* Actor = Pending.Key.Get())
+		{
+			AddActorAbilities(Actor, Pending.Value, *ActiveData);
+		}
+	}
+}
+
+void UGameFeatureAction_AddAbilities::ResolveEntries(FPerContextData& ActiveData) const
+{
+	ActiveData.ResolvedEntries.Reset(AbilitiesList.Num());
+
+	for (const FGameFeatureAbilitiesEntry& Entry : AbilitiesList)
+	{
+		FResolvedAbilitiesEntry& Resolved = ActiveData.ResolvedEntries.AddDefaulted_GetRef();
+
+		for (const FLyraAbilityGrant& Ability : Entry.GrantedAbilities)
+		{
+			if (TSubclassOf<UGameplayAbility> AbilityType = Ability.AbilityType.Get())
+			{
+				Resolved.Abilities.Add(AbilityType);
+			}
+			else if (!Ability.AbilityType.IsNull())
+			{
+				UE_LOG(LogGameFeatures, Error, TEXT("Failed to load ability '%s'. It will not be granted."), *Ability.AbilityType.ToString());
+			}
+		}
+
+		for (const FLyraAttributeSetGrant& Attributes : Entry.GrantedAttributes)
+		{
+			if (TSubclassOf<UAttributeSet> SetType = Attributes.AttributeSetType.Get())
+			{
+				FResolvedAttributeSetGrant& ResolvedSet = Resolved.AttributeSets.AddDefaulted_GetRef();
+				ResolvedSet.SetType = SetType;
+
+				if (const UDataTable* InitData = Attributes.InitializationData.Get())
+				{
+					BuildAttributeInitialValues(SetType, InitData, ResolvedSet.InitialValues);
+				}
+			}
+			else if (!Attributes.AttributeSetType.IsNull())
+			{
+				UE_LOG(LogGameFeatures, Error, TEXT("Failed to load attribute set '%s'. It will not be granted."), *Attributes.AttributeSetType.ToString());
+			}
+		}
+
+		for (const TSoftObjectPtr<const ULyraAbilitySet>& SetPtr : Entry.GrantedAbilitySets)
+		{
+			if (const ULyraAbilitySet* Set = SetPtr.Get())
+			{
+				Resolved.AbilitySets.Add(Set);
+			}
+		}
+	}
+}
+
+void UGameFeatureAction_AddAbilities::BuildAttributeInitialValues(TSubclassOf<UAttributeSet> SetType, const UDataTable* InitializationData, TArray<TPair<FGameplayAttribute, float>>& OutInitialValues)
+{
+	// Same row lookup as UAttributeSet::InitFromMetaDataTable, done once per set type instead of once per granted set
+	static const FString Context = FString(TEXT("UGameFeatureAction_AddAbilities::BuildAttributeInitialValues"));
+
+	for (TFieldIterator<FProperty> It(SetType, EFieldIteratorFlags::IncludeSuper); It; ++It)
+	{
+		FProperty* Property = *It;
+		if (!CastField<FNumericProperty>(Property) && !FGameplayAttribute::IsGameplayAttributeDataProperty(Property))
+		{
+			continue;
+		}
+
+		const FString RowNameStr = FString::Printf(TEXT("%s.%s"), *Property->GetOwnerVariant().GetName(), *Property->GetName());
+		if (const FAttributeMetaData* MetaData = InitializationData->FindRow<FAttributeMetaData>(FName(*RowNameStr), Context, false))
+		{
+			OutInitialValues.Emplace(FGameplayAttribute(Property), MetaData->BaseValue);
+		}
+	}
+}
+
+void UGameFeatureAction_AddAbilities::ApplyAttributeInitialValues(UAttributeSet* AttributeSet, const TArray<TPair<FGameplayAttribute, float>>& InitialValues)
+{
+	for (const TPair<FGameplayAttribute, float>& InitialValue : InitialValues)
+	{
+		const FGameplayAttribute& Attribute = InitialValue.Key;
+		if (FGameplayAttribute::IsGameplayAttributeDataProperty(Attribute.GetUProperty()))
+		{
+			if (FGameplayAttributeData* DataPtr = Attribute.GetGameplayAttributeData(AttributeSet))
+			{
+				DataPtr->SetBaseValue(InitialValue.Value);
+				DataPtr->SetCurrentValue(InitialValue.Value);
+			}
+		}
+		else if (FNumericProperty* NumericProperty = CastField<FNumericProperty>(Attribute.GetUProperty()))
+		{
+			NumericProperty->SetFloatingPointPropertyValue(NumericProperty->ContainerPtrToValuePtr<void>(AttributeSet), InitialValue.Value);
+		}
+	}
 }
 
 void UGameFeatureAction_AddAbilities::HandleActorExtension(AActor* Actor, FName EventName, int32 EntryIndex, FGameFeatureStateChangeContext ChangeContext)
@@ -144,19 +318,18 @@ void UGameFeatureAction_AddAbilities::HandleActorExtension(AActor* Actor, FName
 	FPerContextData* ActiveData = ContextData.Find(ChangeContext);
 	if (AbilitiesList.IsValidIndex(EntryIndex) && ActiveData)
 	{
-		const FGameFeatureAbilitiesEntry& Entry = AbilitiesList[EntryIndex];
 		if ((EventName == UGameFrameworkComponentManager::NAME_ExtensionRemoved) || (EventName == UGameFrameworkComponentManager::NAME_ReceiverRemoved))
 		{
 			RemoveActorAbilities(Actor, *ActiveData);
 		}
 		else if ((EventName == UGameFrameworkComponentManager::NAME_ExtensionAdded) || (EventName == ALyraPlayerState::NAME_LyraAbilityReady))
 		{
-			AddActorAbilities(Actor, Entry, *ActiveData);
+			AddActorAbilities(Actor, EntryIndex, *ActiveData);
 		}
 	}
 }
 
-void UGameFeatureAction_AddAbilities::AddActorAbilities(AActor* Actor, const FGameFeatureAbilitiesEntry& AbilitiesEntry, FPerContextData& ActiveData)
+void UGameFeatureAction_AddAbilities::AddActorAbilities(AActor* Actor, int32 EntryIndex, FPerContextData& ActiveData)
 {
 	check(Actor);
 	if (!Actor->HasAuthority())
@@ -170,54 +343,49 @@ void UGameFeatureAction_AddAbilities::AddActorAbilities(AActor* Actor, const FGa
 		return;	
 	}
 
+	// The grants are still loading, hold on to the actor until they are ready
+	if (!ActiveData.bPreloadComplete)
+	{
+		ActiveData.PendingActors.AddUnique(TPair<TWeakObjectPtr<AActor>, int32>(Actor, EntryIndex));
+		return;
+	}
+
+	if (!ensure(ActiveData.ResolvedEntries.IsValidIndex(EntryIndex)))
+	{
+		return;
+	}
+
+	const FGameFeatureAbilitiesEntry& AbilitiesEntry = AbilitiesList[EntryIndex];
+	const FResolvedAbilitiesEntry& ResolvedEntry = ActiveData.ResolvedEntries[EntryIndex];
+
 	if (UAbilitySystemComponent* AbilitySystemComponent = FindOrAddComponentForActor<UAbilitySystemComponent>(Actor, AbilitiesEntry, ActiveData))
 	{
 		FActorExtensions AddedExtensions;
-		AddedExtensions.Abilities.Reserve(AbilitiesEntry.GrantedAbilities.Num());
-		AddedExtensions.Attributes.Reserve(AbilitiesEntry.GrantedAttributes.Num());
-		AddedExtensions.AbilitySetHandles.Reserve(AbilitiesEntry.GrantedAbilitySets.Num());
+		AddedExtensions.Abilities.Reserve(ResolvedEntry.Abilities.Num());
+		AddedExtensions.Attributes.Reserve(ResolvedEntry.AttributeSets.Num());
+		AddedExtensions.AbilitySetHandles.Reserve(ResolvedEntry.AbilitySets.Num());
 
-		for (const FLyraAbilityGrant& Ability : AbilitiesEntry.GrantedAbilities)
+		for (const TSubclassOf<UGameplayAbility>& AbilityType : ResolvedEntry.Abilities)
 		{
-			if (!Ability.AbilityType.IsNull())
-			{
-				FGameplayAbilitySpec NewAbilitySpec(Ability.AbilityType.LoadSynchronous());
-				FGameplayAbilitySpecHandle AbilityHandle = AbilitySystemComponent->GiveAbility(NewAbilitySpec);
+			FGameplayAbilitySpec NewAbilitySpec(AbilityType);
+			FGameplayAbilitySpecHandle AbilityHandle = AbilitySystemComponent->GiveAbility(NewAbilitySpec);
 
-				AddedExtensions.Abilities.Add(AbilityHandle);
-			}
+			AddedExtensions.Abilities.Add(AbilityHandle);
 		}
 
-		for (const FLyraAttributeSetGrant& Attributes : AbilitiesEntry.GrantedAttributes)
+		for (const FResolvedAttributeSetGrant& Attributes : ResolvedEntry.AttributeSets)
 		{
-			if (!Attributes.AttributeSetType.IsNull())
-			{
-				TSubclassOf<UAttributeSet> SetType = Attributes.AttributeSetType.LoadSynchronous();
-				if (SetType)
-				{
-					UAttributeSet* NewSet = NewObject<UAttributeSet>(AbilitySystemComponent->GetOwner(), SetType);
-					if (!Attributes.InitializationData.IsNull())
-					{
-						UDataTable* InitData = Attributes.InitializationData.LoadSynchronous();
-						if (InitData)
-						{
-							NewSet->InitFromMetaDataTable(InitData);
-						}
-					}
-
-					AddedExtensions.Attributes.Add(NewSet);
-					AbilitySystemComponent->AddAttributeSetSubobject(NewSet);
-				}
-			}
+			UAttributeSet* NewSet = NewObject<UAttributeSet>(AbilitySystemComponent->GetOwner(), Attributes.SetType);
+			ApplyAttributeInitialValues(NewSet, Attributes.InitialValues);
+
+			AddedExtensions.Attributes.Add(NewSet);
+			AbilitySystemComponent->AddAttributeSetSubobject(NewSet);
 		}
 
 		ULyraAbilitySystemComponent* LyraASC = CastChecked<ULyraAbilitySystemComponent>(AbilitySystemComponent);
-		for (const TSoftObjectPtr<const ULyraAbilitySet>& SetPtr : AbilitiesEntry.GrantedAbilitySets)
+		for (const ULyraAbilitySet* Set : ResolvedEntry.AbilitySets)
 		{
-			if (const ULyraAbilitySet* Set = SetPtr.Get())
-			{
-				Set->GiveToAbilitySystem(LyraASC, &AddedExtensions.AbilitySetHandles.AddDefaulted_GetRef());
-			}
+			Set->GiveToAbilitySystem(LyraASC, &AddedExtensions.AbilitySetHandles.AddDefaulted_GetRef());
 		}
 
 		ActiveData.ActiveExtensions.Add(Actor, AddedExtensions);
@@ -230,6 +398,11 @@ void UGameFeatureAction_AddAbilities::AddActorAbilities(AActor* Actor, const FGa
 
 void UGameFeatureAction_AddAbilities::RemoveActorAbilities(AActor* Actor, FPerContextData& ActiveData)
 {
+	ActiveData.PendingActors.RemoveAll([Actor](const TPair<TWeakObjectPtr<AActor>, int32>& Pending)
+		{
+			return Pending.Key == Actor;
+		});
+
 	if (FActorExtensions* ActorExtensions = ActiveData.ActiveExtensions.Find(Actor))
 	{
 		if (UAbilitySystemComponent* AbilitySystemComponent = Actor->FindComponentByClass<UAbilitySystemComponent>())
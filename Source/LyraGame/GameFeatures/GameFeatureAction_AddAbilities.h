@@ -4,6 +4,7 @@
 
 #include "GameFeatureAction_WorldActionBase.h"
 #include "Abilities/GameplayAbility.h"
+#include "AttributeSet.h"
 #include "AbilitySystem/LyraAbilitySet.h"
 
 #include "GameFeatureAction_AddAbilities.generated.h"
@@ -13,6 +14,7 @@ class UInputAction;
 class UAttributeSet;
 class UDataTable;
 struct FComponentRequestHandle;
+struct FStreamableHandle;
 class ULyraAbilitySet;
 
 USTRUCT(BlueprintType)
@@ -100,10 +102,33 @@ private:
 		TArray<FLyraAbilitySet_GrantedHandles> AbilitySetHandles;
 	};
 
+	struct FResolvedAttributeSetGrant
+	{
+		TSubclassOf<UAttributeSet> SetType;
+
+		// Base values from the initialization data table, parsed once for the set type
+		TArray<TPair<FGameplayAttribute, float>> InitialValues;
+	};
+
+	// The loaded contents of an FGameFeatureAbilitiesEntry, kept alive by the preload handle and shared by every actor it is granted to
+	struct FResolvedAbilitiesEntry
+	{
+		TArray<TSubclassOf<UGameplayAbility>> Abilities;
+		TArray<FResolvedAttributeSetGrant> AttributeSets;
+		TArray<const ULyraAbilitySet*> AbilitySets;
+	};
+
 	struct FPerContextData
 	{
 		TMap<AActor*, FActorExtensions> ActiveExtensions;
 		TArray<TSharedPtr<FComponentRequestHandle>> ComponentRequests;
+
+		TSharedPtr<FStreamableHandle> PreloadHandle;
+		TArray<FResolvedAbilitiesEntry> ResolvedEntries;
+		bool bPreloadComplete = false;
+
+		// Actors that asked for their abilities before the preload finished, granted once it does
+		TArray<TPair<TWeakObjectPtr<AActor>, int32>> PendingActors;
 	};
 	
 	TMap<FGameFeatureStateChangeContext, FPerContextData> ContextData;	
@@ -113,8 +138,13 @@ private:
 	//~ End UGameFeatureAction_WorldActionBase interface
 
 	void Reset(FPerContextData& ActiveData);
+	void StartPreload(FPerContextData& ActiveData, const FGameFeatureStateChangeContext& ChangeContext);
+	void OnPreloadComplete(FGameFeatureStateChangeContext ChangeContext);
+	void ResolveEntries(FPerContextData& ActiveData) const;
+	static void BuildAttributeInitialValues(TSubclassOf<UAttributeSet> SetType, const UDataTable* InitializationData, TArray<TPair<FGameplayAttribute, float>>& OutInitialValues);
+	static void ApplyAttributeInitialValues(UAttributeSet* AttributeSet, const TArray<TPair<FGameplayAttribute, float>>& InitialValues);
 	void HandleActorExtension(AActor* Actor, FName EventName, int32 EntryIndex, FGameFeatureStateChangeContext ChangeContext);
-	void AddActorAbilities(AActor* Actor, const FGameFeatureAbilitiesEntry& AbilitiesEntry, FPerContextData& ActiveData);
+	void AddActorAbilities(AActor* Actor, int32 EntryIndex, FPerContextData& ActiveData);
 	void RemoveActorAbilities(AActor* Actor, FPerContextData& ActiveData);
 
 	template<class ComponentType>
@@ -0,0 +1,178 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LyraInteractionSubsystem.h"
+
+#include "Components/SceneComponent.h"
+#include "GameFramework/Actor.h"
+#include "Interaction/IInteractableTarget.h"
+#include "Interaction/InteractionStatics.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(LyraInteractionSubsystem)
+
+namespace LyraInteraction
+{
+	// Big enough that a scan rarely touches more than four cells for typical interaction ranges
+	static constexpr double CellSize = 1000.0;
+}
+
+void ULyraInteractionSubsystem::RegisterInteractable(TScriptInterface<IInteractableTarget> Interactable)
+{
+	UObject* Object = Interactable.GetObject();
+	if (Object == nullptr || Interactable.GetInterface() == nullptr)
+	{
+		return;
+	}
+
+	const FObjectKey Key(Object);
+	if (Interactables.Contains(Key))
+	{
+		UpdateInteractableLocation(Interactable);
+		return;
+	}
+
+	FInteractableEntry& Entry = Interactables.Add(Key);
+	Entry.Object = Object;
+	Entry.Interface = Interactable.GetInterface();
+	Entry.Location = GetInteractableLocation(Interactable);
+	Entry.Cell = GetCell(Entry.Location);
+	Cells.FindOrAdd(Entry.Cell).Add(Key);
+
+	if (const AActor* Actor = UInteractionStatics::GetActorFromInteractableTarget(Interactable))
+	{
+		TrackComponent(Key, Entry, Actor->GetRootComponent());
+	}
+
+	OnInteractableRegistered.Broadcast(Interactable);
+}
+
+void ULyraInteractionSubsystem::UnregisterInteractable(TScriptInterface<IInteractableTarget> Interactable)
+{
+	const FObjectKey Key(Interactable.GetObject());
+
+	FInteractableEntry Entry;
+	if (Interactables.RemoveAndCopyValue(Key, Entry))
+	{
+		StopTrackingComponent(Entry);
+		RemoveFromCell(Key, Entry.Cell);
+		OnInteractableUnregistered.Broadcast(Interactable);
+	}
+}
+
+void ULyraInteractionSubsystem::UpdateInteractableLocation(TScriptInterface<IInteractableTarget> Interactable)
+{
+	const FObjectKey Key(Interactable.GetObject());
+	if (FInteractableEntry* Entry = Interactables.Find(Key))
+	{
+		const AActor* Actor = UInteractionStatics::GetActorFromInteractableTarget(Interactable);
+		TrackComponent(Key, *Entry, Actor ? Actor->GetRootComponent() : nullptr);
+		SetEntryLocation(Key, *Entry, GetInteractableLocation(Interactable));
+	}
+}
+
+void ULyraInteractionSubsystem::GetInteractablesInRange(const FVector& Location, float Range, TArray<TScriptInterface<IInteractableTarget>>& OutInteractables) const
+{
+	const FIntPoint MinCell = GetCell(Location - FVector(Range));
+	const FIntPoint MaxCell = GetCell(Location + FVector(Range));
+	const double RangeSquared = FMath::Square(static_cast<double>(Range));
+
+	for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+	{
+		for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+		{
+			const TArray<FObjectKey>* CellKeys = Cells.Find(FIntPoint(CellX, CellY));
+			if (CellKeys == nullptr)
+			{
+				continue;
+			}
+
+			for (const FObjectKey& Key : *CellKeys)
+			{
+				const FInteractableEntry& Entry = Interactables.FindChecked(Key);
+				UObject* Object = Entry.Object.Get();
+				if (Object && (FVector::DistSquared(Entry.Location, Location) <= RangeSquared))
+				{
+					TScriptInterface<IInteractableTarget>& Interactable = OutInteractables.AddDefaulted_GetRef();
+					Interactable.SetObject(Object);
+					Interactable.SetInterface(Entry.Interface);
+				}
+			}
+		}
+	}
+}
+
+bool ULyraInteractionSubsystem::IsInteractableInRange(TScriptInterface<IInteractableTarget> Interactable, const FVector& Location, float Range) const
+{
+	const FInteractableEntry* Entry = Interactables.Find(FObjectKey(Interactable.GetObject()));
+	return Entry && Entry->Object.IsValid() && (FVector::DistSquared(Entry->Location, Location) <= FMath::Square(static_cast<double>(Range)));
+}
+
+FIntPoint ULyraInteractionSubsystem::GetCell(const FVector& Location)
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / LyraInteraction::CellSize), FMath::FloorToInt32(Location.Y / LyraInteraction::CellSize));
+}
+
+FVector ULyraInteractionSubsystem::GetInteractableLocation(const TScriptInterface<IInteractableTarget>& Interactable)
+{
+	const AActor* Actor = UInteractionStatics::GetActorFromInteractableTarget(Interactable);
+	return Actor ? Actor->GetActorLocation() : FVector::ZeroVector;
+}
+
+void ULyraInteractionSubsystem::RemoveFromCell(const FObjectKey& Key, const FIntPoint& Cell)
+{
+	if (TArray<FObjectKey>* CellKeys = Cells.Find(Cell))
+	{
+		CellKeys->RemoveSingleSwap(Key);
+		if (CellKeys->IsEmpty())
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
+
+void ULyraInteractionSubsystem::SetEntryLocation(const FObjectKey& Key, FInteractableEntry& Entry, const FVector& NewLocation)
+{
+	Entry.Location = NewLocation;
+
+	const FIntPoint NewCell = GetCell(NewLocation);
+	if (NewCell != Entry.Cell)
+	{
+		RemoveFromCell(Key, Entry.Cell);
+		Cells.FindOrAdd(NewCell).Add(Key);
+		Entry.Cell = NewCell;
+	}
+}
+
+void ULyraInteractionSubsystem::TrackComponent(const FObjectKey& Key, FInteractableEntry& Entry, USceneComponent* Component)
+{
+	if (Entry.TrackedComponent.Get() == Component)
+	{
+		return;
+	}
+
+	StopTrackingComponent(Entry);
+
+	if (Component != nullptr)
+	{
+		Entry.TrackedComponent = Component;
+		Entry.TransformUpdatedHandle = Component->TransformUpdated.AddUObject(this, &ThisClass::HandleTrackedComponentTransformUpdated, Key);
+	}
+}
+
+void ULyraInteractionSubsystem::StopTrackingComponent(FInteractableEntry& Entry)
+{
+	if (USceneComponent* Component = Entry.TrackedComponent.Get())
+	{
+		Component->TransformUpdated.Remove(Entry.TransformUpdatedHandle);
+	}
+
+	Entry.TrackedComponent.Reset();
+	Entry.TransformUpdatedHandle.Reset();
+}
+
+void ULyraInteractionSubsystem::HandleTrackedComponentTransformUpdated(USceneComponent* Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, FObjectKey Key)
+{
+	if (FInteractableEntry* Entry = Interactables.Find(Key))
+	{
+		SetEntryLocation(Key, *Entry, Component->GetComponentLocation());
+	}
+}
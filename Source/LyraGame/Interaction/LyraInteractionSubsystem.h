@@ -0,0 +1,73 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+
+#include "LyraInteractionSubsystem.generated.h"
+
+#define UE_API LYRAGAME_API
+
+template <typename InterfaceType> class TScriptInterface;
+
+class IInteractableTarget;
+class UObject;
+class USceneComponent;
+enum class ETeleportType : uint8;
+enum class EUpdateTransformFlags : int32;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FLyraInteractableChangedDelegate, const TScriptInterface<IInteractableTarget>& /*Interactable*/);
+
+/**
+ * Keeps every registered interactable in a coarse spatial hash, so nearby interactables can be found without
+ * physics queries. Interactables register themselves when they begin play and unregister when they end play, and
+ * their cell follows the root component of their actor while they are registered.
+ */
+UCLASS(MinimalAPI)
+class ULyraInteractionSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UE_API void RegisterInteractable(TScriptInterface<IInteractableTarget> Interactable);
+	UE_API void UnregisterInteractable(TScriptInterface<IInteractableTarget> Interactable);
+
+	// Re-reads the location of the interactable, moves are picked up automatically so this is only needed if its actor
+	// switched root components or it was registered before its actor had one
+	UE_API void UpdateInteractableLocation(TScriptInterface<IInteractableTarget> Interactable);
+
+	// Appends the registered interactables whose actors are within Range of Location
+	UE_API void GetInteractablesInRange(const FVector& Location, float Range, TArray<TScriptInterface<IInteractableTarget>>& OutInteractables) const;
+
+	UE_API bool IsInteractableInRange(TScriptInterface<IInteractableTarget> Interactable, const FVector& Location, float Range) const;
+
+	FLyraInteractableChangedDelegate OnInteractableRegistered;
+	FLyraInteractableChangedDelegate OnInteractableUnregistered;
+
+private:
+	struct FInteractableEntry
+	{
+		TWeakObjectPtr<UObject> Object;
+		IInteractableTarget* Interface = nullptr;
+		FVector Location = FVector::ZeroVector;
+		FIntPoint Cell = FIntPoint::ZeroValue;
+		TWeakObjectPtr<USceneComponent> TrackedComponent;
+		FDelegateHandle TransformUpdatedHandle;
+	};
+
+	static FIntPoint GetCell(const FVector& Location);
+	static FVector GetInteractableLocation(const TScriptInterface<IInteractableTarget>& Interactable);
+
+	void RemoveFromCell(const FObjectKey& Key, const FIntPoint& Cell);
+	void SetEntryLocation(const FObjectKey& Key, FInteractableEntry& Entry, const FVector& NewLocation);
+
+	void TrackComponent(const FObjectKey& Key, FInteractableEntry& Entry, USceneComponent* Component);
+	void StopTrackingComponent(FInteractableEntry& Entry);
+	void HandleTrackedComponentTransformUpdated(USceneComponent* Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, FObjectKey Key);
+
+	TMap<FObjectKey, FInteractableEntry> Interactables;
+	TMap<FIntPoint, TArray<FObjectKey>> Cells;
+};
+
+#undef UE_API
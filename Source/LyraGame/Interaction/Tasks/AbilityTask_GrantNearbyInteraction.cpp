@@ -10,11 +10,22 @@
 #include "Interaction/InteractionOption.h"
 #include "Interaction/InteractionQuery.h"
 #include "Interaction/InteractionStatics.h"
+#include "Interaction/LyraInteractionSubsystem.h"
 #include "Physics/LyraCollisionChannels.h"
 #include "TimerManager.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AbilityTask_GrantNearbyInteraction)
 
+namespace LyraInteraction
+{
+	static bool bUseInteractionSubsystem = true;
+	static FAutoConsoleVariableRef CVarUseInteractionSubsystem(
+		TEXT("Lyra.Interaction.UseInteractionSubsystem"),
+		bUseInteractionSubsystem,
+		TEXT("Should nearby interaction scans look up registered interactables instead of running a physics overlap"),
+		ECVF_Default);
+}
+
 UAbilityTask_GrantNearbyInteraction::UAbilityTask_GrantNearbyInteraction(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -32,6 +43,13 @@ void UAbilityTask_GrantNearbyInteraction::Activate()
 {
 	SetWaitingOnAvatar();
 
+	if (ULyraInteractionSubsystem* InteractionSubsystem = GetInteractionSubsystem())
+	{
+		InteractionSubsystem->OnInteractableRegistered.AddUObject(this, &ThisClass::HandleInteractableRegistered);
+		InteractionSubsystem->OnInteractableUnregistered.AddUObject(this, &ThisClass::HandleInteractableUnregistered);
+	}
+
+	// Still needed to notice interactables entering and leaving the range as the avatar moves
 	UWorld* World = GetWorld();
 	World->GetTimerManager().SetTimer(QueryTimerHandle, this, &ThisClass::QueryInteractables, InteractionScanRate, true);
 }
@@ -41,11 +59,23 @@ void UAbilityTask_GrantNearbyInteraction::OnDestroy(bool AbilityEnded)
 	if (UWorld* World = GetWorld())
 	{
 		World->GetTimerManager().ClearTimer(QueryTimerHandle);
+
+		if (ULyraInteractionSubsystem* InteractionSubsystem = World->GetSubsystem<ULyraInteractionSubsystem>())
+		{
+			InteractionSubsystem->OnInteractableRegistered.RemoveAll(this);
+			InteractionSubsystem->OnInteractableUnregistered.RemoveAll(this);
+		}
 	}
 
 	Super::OnDestroy(AbilityEnded);
 }
 
+ULyraInteractionSubsystem* UAbilityTask_GrantNearbyInteraction::GetInteractionSubsystem() const
+{
+	UWorld* World = GetWorld();
+	return (World && LyraInteraction::bUseInteractionSubsystem) ? World->GetSubsystem<ULyraInteractionSubsystem>() : nullptr;
+}
+
 void UAbilityTask_GrantNearbyInteraction::QueryInteractables()
 {
 	UWorld* World = GetWorld();
@@ -53,41 +83,96 @@ void UAbilityTask_GrantNearbyInteraction::QueryInteractables()
 	
 	if (World && ActorOwner)
 	{
-		FCollisionQueryParams Params(SCENE_QUERY_STAT(UAbilityTask_GrantNearbyInteraction), false);
+		TArray<TScriptInterface<IInteractableTarget>> InteractableTargets;
 
-		TArray<FOverlapResult> OverlapResults;
-		World->OverlapMultiByChannel(OUT OverlapResults, ActorOwner->GetActorLocation(), FQuat::Identity, Lyra_TraceChannel_Interaction, FCollisionShape::MakeSphere(InteractionScanRange), Params);
-
-		if (OverlapResults.Num() > 0)
+		if (ULyraInteractionSubsystem* InteractionSubsystem = GetInteractionSubsystem())
+		{
+			InteractionSubsystem->GetInteractablesInRange(ActorOwner->GetActorLocation(), InteractionScanRange, OUT InteractableTargets);
+		}
+		else
 		{
-			TArray<TScriptInterface<IInteractableTarget>> InteractableTargets;
+			FCollisionQueryParams Params(SCENE_QUERY_STAT(UAbilityTask_GrantNearbyInteraction), false);
+
+			TArray<FOverlapResult> OverlapResults;
+			World->OverlapMultiByChannel(OUT OverlapResults, ActorOwner->GetActorLocation(), FQuat::Identity, Lyra_TraceChannel_Interaction, FCollisionShape::MakeSphere(InteractionScanRange), Params);
+
 			UInteractionStatics::AppendInteractableTargetsFromOverlapResults(OverlapResults, OUT InteractableTargets);
-			
-			FInteractionQuery InteractionQuery;
-			InteractionQuery.RequestingAvatar = ActorOwner;
-			InteractionQuery.RequestingController = Cast<AController>(ActorOwner->GetOwner());
+		}
 
-			TArray<FInteractionOption> Options;
-			for (TScriptInterface<IInteractableTarget>& InteractiveTarget : InteractableTargets)
+		// Only interactables that just came into range need their options gathered, the rest were handled by an earlier scan
+		TSet<FObjectKey> NewInteractablesInRange;
+		NewInteractablesInRange.Reserve(InteractableTargets.Num());
+
+		TArray<TScriptInterface<IInteractableTarget>> EnteredTargets;
+		for (const TScriptInterface<IInteractableTarget>& InteractableTarget : InteractableTargets)
+		{
+			const FObjectKey TargetKey(InteractableTarget.GetObject());
+			NewInteractablesInRange.Add(TargetKey);
+
+			if (!InteractablesInRange.Contains(TargetKey))
 			{
-				FInteractionOptionBuilder InteractionBuilder(InteractiveTarget, Options);
-				InteractiveTarget->GatherInteractionOptions(InteractionQuery, InteractionBuilder);
+				EnteredTargets.Add(InteractableTarget);
 			}
+		}
+
+		InteractablesInRange = MoveTemp(NewInteractablesInRange);
+
+		GrantAbilitiesForInteractables(EnteredTargets);
+	}
+}
 
-			// Check if any of the options need to grant the ability to the user before they can be used.
-			for (FInteractionOption& Option : Options)
+void UAbilityTask_GrantNearbyInteraction::HandleInteractableRegistered(const TScriptInterface<IInteractableTarget>& Interactable)
+{
+	AActor* ActorOwner = GetAvatarActor();
+	ULyraInteractionSubsystem* InteractionSubsystem = GetInteractionSubsystem();
+	if (ActorOwner && InteractionSubsystem && InteractionSubsystem->IsInteractableInRange(Interactable, ActorOwner->GetActorLocation(), InteractionScanRange))
+	{
+		bool bAlreadyInRange = false;
+		InteractablesInRange.Add(FObjectKey(Interactable.GetObject()), &bAlreadyInRange);
+
+		if (!bAlreadyInRange)
+		{
+			GrantAbilitiesForInteractables({ Interactable });
+		}
+	}
+}
+
+void UAbilityTask_GrantNearbyInteraction::HandleInteractableUnregistered(const TScriptInterface<IInteractableTarget>& Interactable)
+{
+	InteractablesInRange.Remove(FObjectKey(Interactable.GetObject()));
+}
+
+void UAbilityTask_GrantNearbyInteraction::GrantAbilitiesForInteractables(const TArray<TScriptInterface<IInteractableTarget>>& InteractableTargets)
+{
+	AActor* ActorOwner = GetAvatarActor();
+	if ((ActorOwner == nullptr) || InteractableTargets.IsEmpty())
+	{
+		return;
+	}
+
+	FInteractionQuery InteractionQuery;
+	InteractionQuery.RequestingAvatar = ActorOwner;
+	InteractionQuery.RequestingController = Cast<AController>(ActorOwner->GetOwner());
+
+	TArray<FInteractionOption> Options;
+	for (const TScriptInterface<IInteractableTarget>& InteractiveTarget : InteractableTargets)
+	{
+		FInteractionOptionBuilder InteractionBuilder(InteractiveTarget, Options);
+		InteractiveTarget->GatherInteractionOptions(InteractionQuery, InteractionBuilder);
+	}
+
+	// Check if any of the options need to grant the ability to the user before they can be used.
+	for (FInteractionOption& Option : Options)
+	{
+		if (Option.InteractionAbilityToGrant)
+		{
+			// Grant the ability to the GAS, otherwise it won't be able to do whatever the interaction is.
+			FObjectKey ObjectKey(Option.InteractionAbilityToGrant);
+			if (!InteractionAbilityCache.Find(ObjectKey))
 			{
-				if (Option.InteractionAbilityToGrant)
-				{
-					// Grant the ability to the GAS, otherwise it won't be able to do whatever the interaction is.
-					FObjectKey ObjectKey(Option.InteractionAbilityToGrant);
-					if (!InteractionAbilityCache.Find(ObjectKey))
-					{
-						FGameplayAbilitySpec Spec(Option.InteractionAbilityToGrant, 1, INDEX_NONE, this);
-						FGameplayAbilitySpecHandle Handle = AbilitySystemComponent->GiveAbility(Spec);
-						InteractionAbilityCache.Add(ObjectKey, Handle);
-					}
-				}
+				FGameplayAbilitySpec Spec(Option.InteractionAbilityToGrant, 1, INDEX_NONE, this);
+				FGameplayAbilitySpecHandle Handle = AbilitySystemComponent->GiveAbility(Spec);
+				InteractionAbilityCache.Add(ObjectKey, Handle);
 			}
 		}
 	}
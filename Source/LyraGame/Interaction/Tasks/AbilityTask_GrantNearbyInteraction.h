@@ -5,7 +5,9 @@
 
 #include "AbilityTask_GrantNearbyInteraction.generated.h"
 
+class IInteractableTarget;
 class UGameplayAbility;
+class ULyraInteractionSubsystem;
 class UObject;
 struct FFrame;
 struct FGameplayAbilitySpecHandle;
@@ -28,10 +30,21 @@ private:
 
 	void QueryInteractables();
 
+	// Enter and exit events from the interaction subsystem, so registered interactables don't have to wait for the next scan
+	void HandleInteractableRegistered(const TScriptInterface<IInteractableTarget>& Interactable);
+	void HandleInteractableUnregistered(const TScriptInterface<IInteractableTarget>& Interactable);
+
+	void GrantAbilitiesForInteractables(const TArray<TScriptInterface<IInteractableTarget>>& InteractableTargets);
+
+	ULyraInteractionSubsystem* GetInteractionSubsystem() const;
+
 	float InteractionScanRange = 100;
 	float InteractionScanRate = 0.100;
 
 	FTimerHandle QueryTimerHandle;
 
 	TMap<FObjectKey, FGameplayAbilitySpecHandle> InteractionAbilityCache;
+
+	// Interactables that were in range during the last scan, their options have already been gathered
+	TSet<FObjectKey> InteractablesInRange;
 };
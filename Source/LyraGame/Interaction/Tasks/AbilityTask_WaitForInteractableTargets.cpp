@@ -3,6 +3,7 @@
 #include "Interaction/Tasks/AbilityTask_WaitForInteractableTargets.h"
 
 #include "AbilitySystemComponent.h"
+#include "Camera/LyraCameraFocusSubsystem.h"
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
 #include "Interaction/IInteractableTarget.h"
@@ -44,9 +45,21 @@ void UAbilityTask_WaitForInteractableTargets::AimWithPlayerController(const AAct
 	APlayerController* PC = Ability->GetCurrentActorInfo()->PlayerController.Get();
 	check(PC);
 
+	// Local players share one camera trace per frame, others (e.g., remote players on the server) trace themselves
+	ULyraCameraFocusSubsystem* CameraFocusSubsystem = ULyraCameraFocusSubsystem::Get(PC);
+	const FLyraCameraFocus* CameraFocus = CameraFocusSubsystem ? &CameraFocusSubsystem->GetCameraFocus(TraceProfile.Name) : nullptr;
+
 	FVector ViewStart;
 	FRotator ViewRot;
-	PC->GetPlayerViewPoint(ViewStart, ViewRot);
+	if (CameraFocus)
+	{
+		ViewStart = CameraFocus->ViewLocation;
+		ViewRot = CameraFocus->ViewRotation;
+	}
+	else
+	{
+		PC->GetPlayerViewPoint(ViewStart, ViewRot);
+	}
 
 	const FVector ViewDir = ViewRot.Vector();
 	FVector ViewEnd = ViewStart + (ViewDir * MaxRange);
@@ -54,7 +67,18 @@ void UAbilityTask_WaitForInteractableTargets::AimWithPlayerController(const AAct
 	ClipCameraRayToAbilityRange(ViewStart, ViewDir, TraceStart, MaxRange, ViewEnd);
 
 	FHitResult HitResult;
-	LineTrace(HitResult, InSourceActor->GetWorld(), ViewStart, ViewEnd, TraceProfile.Name, Params);
+	if (CameraFocus)
+	{
+		// The shared trace reaches further than this one, only hits before the clipped end count
+		if (CameraFocus->bHasHit && (CameraFocus->Hit.Distance <= FVector::Dist(ViewStart, ViewEnd)))
+		{
+			HitResult = CameraFocus->Hit;
+		}
+	}
+	else
+	{
+		LineTrace(HitResult, InSourceActor->GetWorld(), ViewStart, ViewEnd, TraceProfile.Name, Params);
+	}
 
 	const bool bUseTraceResult = HitResult.bBlockingHit && (FVector::DistSquared(TraceStart, HitResult.Location) <= (MaxRange * MaxRange));
 
@@ -2,7 +2,6 @@
 
 #include "LyraInventoryManagerComponent.h"
 
-#include "Engine/ActorChannel.h"
 #include "Engine/World.h"
 #include "GameFramework/GameplayMessageSubsystem.h"
 #include "LyraInventoryItemDefinition.h"
@@ -13,7 +12,6 @@
 #include UE_INLINE_GENERATED_CPP_BY_NAME(LyraInventoryManagerComponent)
 
 class FLifetimeProperty;
-struct FReplicationFlags;
 
 UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Lyra_Inventory_Message_StackChanged, "Lyra.Inventory.Message.StackChanged");
 
@@ -42,6 +40,8 @@ void FLyraInventoryList::PreReplicatedRemove(const TArrayView<int32> RemovedIndi
 		BroadcastChangeMessage(Stack, /*OldCount=*/ Stack.StackCount, /*NewCount=*/ 0);
 		Stack.LastObservedCount = 0;
 	}
+
+	bIndexDirty = true;
 }
 
 void FLyraInventoryList::PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize)
@@ -52,6 +52,8 @@ void FLyraInventoryList::PostReplicatedAdd(const TArrayView<int32> AddedIndices,
 		BroadcastChangeMessage(Stack, /*OldCount=*/ 0, /*NewCount=*/ Stack.StackCount);
 		Stack.LastObservedCount = Stack.StackCount;
 	}
+
+	bIndexDirty = true;
 }
 
 void FLyraInventoryList::PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize)
@@ -63,6 +65,9 @@ void FLyraInventoryList::PostReplicatedChange(const TArrayView<int32> ChangedInd
 		BroadcastChangeMessage(Stack, /*OldCount=*/ Stack.LastObservedCount, /*NewCount=*/ Stack.StackCount);
 		Stack.LastObservedCount = Stack.StackCount;
 	}
+
+	// The instance of an entry may have just been mapped
+	bIndexDirty = true;
 }
 
 void FLyraInventoryList::BroadcastChangeMessage(FLyraInventoryEntry& Entry, int32 OldCount, int32 NewCount)
@@ -101,6 +106,8 @@ ULyraInventoryItemInstance* FLyraInventoryList::AddEntry(TSubclassOf<ULyraInvent
 	NewEntry.StackCount = StackCount;
 	Result = NewEntry.Instance;
 
+	AddToIndex(Result);
+
 	//const ULyraInventoryItemDefinition* ItemCDO = GetDefault<ULyraInventoryItemDefinition>(ItemDef);
 	MarkItemDirty(NewEntry);
 
@@ -123,20 +130,85 @@ void FLyraInventoryList::RemoveEntry(ULyraInventoryItemInstance* Instance)
 			MarkArrayDirty();
 		}
 	}
+
+	RemoveFromIndex(Instance);
 }
 
 TArray<ULyraInventoryItemInstance*> FLyraInventoryList::GetAllItems() const
 {
-	TArray<ULyraInventoryItemInstance*> Results;
-	Results.Reserve(Entries.Num());
+	return TArray<ULyraInventoryItemInstance*>(GetAllItemsView());
+}
+
+TConstArrayView<ULyraInventoryItemInstance*> FLyraInventoryList::GetAllItemsView() const
+{
+	RebuildIndexIfDirty();
+	return AllItems;
+}
+
+TConstArrayView<ULyraInventoryItemInstance*> FLyraInventoryList::GetItemsByDefinition(TSubclassOf<ULyraInventoryItemDefinition> ItemDef) const
+{
+	RebuildIndexIfDirty();
+	if (const TArray<ULyraInventoryItemInstance*>* Items = ItemsByDefinition.Find(ItemDef))
+	{
+		return *Items;
+	}
+	return TConstArrayView<ULyraInventoryItemInstance*>();
+}
+
+void FLyraInventoryList::AddToIndex(ULyraInventoryItemInstance* Instance)
+{
+	// A dirty index gets rebuilt from Entries on the next query anyway
+	if (!bIndexDirty && Instance != nullptr)
+	{
+		AllItems.Add(Instance);
+		ItemsByDefinition.FindOrAdd(Instance->GetItemDef()).Add(Instance);
+	}
+}
+
+void FLyraInventoryList::RemoveFromIndex(ULyraInventoryItemInstance* Instance)
+{
+	if (!bIndexDirty && Instance != nullptr)
+	{
+		AllItems.RemoveSingle(Instance);
+		if (TArray<ULyraInventoryItemInstance*>* Items = ItemsByDefinition.Find(Instance->GetItemDef()))
+		{
+			Items->RemoveSingle(Instance);
+			if (Items->IsEmpty())
+			{
+				ItemsByDefinition.Remove(Instance->GetItemDef());
+			}
+		}
+	}
+}
+
+void FLyraInventoryList::RebuildIndexIfDirty() const
+{
+	if (!bIndexDirty)
+	{
+		return;
+	}
+
+	AllItems.Reset();
+	ItemsByDefinition.Reset();
+	bIndexDirty = false;
+
 	for (const FLyraInventoryEntry& Entry : Entries)
 	{
 		if (Entry.Instance != nullptr) //@TODO: Would prefer to not deal with this here and hide it further?
 		{
-			Results.Add(Entry.Instance);
+			AllItems.Add(Entry.Instance);
+
+			if (TSubclassOf<ULyraInventoryItemDefinition> ItemDef = Entry.Instance->GetItemDef())
+			{
+				ItemsByDefinition.FindOrAdd(ItemDef).Add(Entry.Instance);
+			}
+			else
+			{
+				// The item definition hasn't replicated yet, try again on the next query
+				bIndexDirty = true;
+			}
 		}
 	}
-	return Results;
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -147,6 +219,9 @@ ULyraInventoryManagerComponent::ULyraInventoryManagerComponent(const FObjectInit
 	, InventoryList(this)
 {
 	SetIsReplicatedByDefault(true);
+
+	// Item instances are registered as they are added instead of being walked in ReplicateSubobjects
+	bReplicateUsingRegisteredSubObjectList = true;
 }
 
 void ULyraInventoryManagerComponent::GetLifetimeReplicatedProps(TArray< FLifetimeProperty >& OutLifetimeProps) const
@@ -201,18 +276,23 @@ TArray<ULyraInventoryItemInstance*> ULyraInventoryManagerComponent::GetAllItems(
 	return InventoryList.GetAllItems();
 }
 
+TConstArrayView<ULyraInventoryItemInstance*> ULyraInventoryManagerComponent::GetAllItemsView() const
+{
+	return InventoryList.GetAllItemsView();
+}
+
+TConstArrayView<ULyraInventoryItemInstance*> ULyraInventoryManagerComponent::GetItemsByDefinition(TSubclassOf<ULyraInventoryItemDefinition> ItemDef) const
+{
+	return InventoryList.GetItemsByDefinition(ItemDef);
+}
+
 ULyraInventoryItemInstance* ULyraInventoryManagerComponent::FindFirstItemStackByDefinition(TSubclassOf<ULyraInventoryItemDefinition> ItemDef) const
 {
-	for (const FLyraInventoryEntry& Entry : InventoryList.Entries)
+	for (ULyraInventoryItemInstance* Instance : InventoryList.GetItemsByDefinition(ItemDef))
 	{
-		ULyraInventoryItemInstance* Instance = Entry.Instance;
-
 		if (IsValid(Instance))
 		{
-			if (Instance->GetItemDef() == ItemDef)
-			{
-				return Instance;
-			}
+			return Instance;
 		}
 	}
 
@@ -222,16 +302,11 @@ ULyraInventoryItemInstance* ULyraInventoryManagerComponent::FindFirstItemStackBy
 int32 ULyraInventoryManagerComponent::GetTotalItemCountByDefinition(TSubclassOf<ULyraInventoryItemDefinition> ItemDef) const
 {
 	int32 TotalCount = 0;
-	for (const FLyraInventoryEntry& Entry : InventoryList.Entries)
+	for (ULyraInventoryItemInstance* Instance : InventoryList.GetItemsByDefinition(ItemDef))
 	{
-		ULyraInventoryItemInstance* Instance = Entry.Instance;
-
 		if (IsValid(Instance))
 		{
-			if (Instance->GetItemDef() == ItemDef)
-			{
-				++TotalCount;
-			}
+			++TotalCount;
 		}
 	}
 
@@ -246,22 +321,27 @@ bool ULyraInventoryManagerComponent::ConsumeItemsByDefinition(TSubclassOf<ULyraI
 		return false;
 	}
 
-	//@TODO: N squared right now as there's no acceleration structure
-	int32 TotalConsumed = 0;
-	while (TotalConsumed < NumToConsume)
+	// Copy the stacks to consume out of the index first, removing them updates it
+	TArray<ULyraInventoryItemInstance*, TInlineAllocator<8>> ToConsume;
+	for (ULyraInventoryItemInstance* Instance : InventoryList.GetItemsByDefinition(ItemDef))
 	{
-		if (ULyraInventoryItemInstance* Instance = ULyraInventoryManagerComponent::FindFirstItemStackByDefinition(ItemDef))
+		if (ToConsume.Num() == NumToConsume)
 		{
-			InventoryList.RemoveEntry(Instance);
-			++TotalConsumed;
+			break;
 		}
-		else
+
+		if (IsValid(Instance))
 		{
-			return false;
+			ToConsume.Add(Instance);
 		}
 	}
 
-	return TotalConsumed == NumToConsume;
+	for (ULyraInventoryItemInstance* Instance : ToConsume)
+	{
+		RemoveItemInstance(Instance);
+	}
+
+	return ToConsume.Num() == NumToConsume;
 }
 
 void ULyraInventoryManagerComponent::ReadyForReplication()
@@ -283,23 +363,6 @@ void ULyraInventoryManagerComponent::ReadyForReplication()
 	}
 }
 
-bool ULyraInventoryManagerComponent::ReplicateSubobjects(UActorChannel* Channel, class FOutBunch* Bunch, FReplicationFlags* RepFlags)
-{
-	bool WroteSomething = Super::ReplicateSubobjects(Channel, Bunch, RepFlags);
-
-	for (FLyraInventoryEntry& Entry : InventoryList.Entries)
-	{
-		ULyraInventoryItemInstance* Instance = Entry.Instance;
-
-		if (Instance && IsValid(Instance))
-		{
-			WroteSomething |= Channel->ReplicateSubobject(Instance, *Bunch, *RepFlags);
-		}
-	}
-
-	return WroteSomething;
-}
-
 //////////////////////////////////////////////////////////////////////
 //
 
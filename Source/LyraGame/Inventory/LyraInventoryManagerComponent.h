@@ -16,7 +16,6 @@ class UObject;
 struct FFrame;
 struct FLyraInventoryList;
 struct FNetDeltaSerializeInfo;
-struct FReplicationFlags;
 
 /** A message when an item is added to the inventory */
 USTRUCT(BlueprintType)
@@ -81,6 +80,12 @@ struct FLyraInventoryList : public FFastArraySerializer
 
 	TArray<ULyraInventoryItemInstance*> GetAllItems() const;
 
+	/** Non-allocating view of all the item instances, valid until the list changes */
+	TConstArrayView<ULyraInventoryItemInstance*> GetAllItemsView() const;
+
+	/** Non-allocating view of the item instances of a definition, valid until the list changes */
+	TConstArrayView<ULyraInventoryItemInstance*> GetItemsByDefinition(TSubclassOf<ULyraInventoryItemDefinition> ItemDef) const;
+
 public:
 	//~FFastArraySerializer contract
 	void PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize);
@@ -101,6 +106,10 @@ public:
 private:
 	void BroadcastChangeMessage(FLyraInventoryEntry& Entry, int32 OldCount, int32 NewCount);
 
+	void AddToIndex(ULyraInventoryItemInstance* Instance);
+	void RemoveFromIndex(ULyraInventoryItemInstance* Instance);
+	void RebuildIndexIfDirty() const;
+
 private:
 	friend ULyraInventoryManagerComponent;
 
@@ -111,6 +120,12 @@ private:
 
 	UPROPERTY(NotReplicated)
 	TObjectPtr<UActorComponent> OwnerComponent;
+
+	// Lookup structures over Entries, which keeps the instances alive. Kept up to date by AddEntry and RemoveEntry,
+	// rebuilt lazily after replication since the item definition of a new instance may not have arrived yet.
+	mutable TArray<ULyraInventoryItemInstance*> AllItems;
+	mutable TMap<TSubclassOf<ULyraInventoryItemDefinition>, TArray<ULyraInventoryItemInstance*>> ItemsByDefinition;
+	mutable bool bIndexDirty = true;
 };
 
 template<>
@@ -154,6 +169,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category=Inventory, BlueprintPure=false)
 	UE_API TArray<ULyraInventoryItemInstance*> GetAllItems() const;
 
+	/** Same as GetAllItems without copying, valid until the inventory changes */
+	UE_API TConstArrayView<ULyraInventoryItemInstance*> GetAllItemsView() const;
+
+	/** All the item stacks of a definition, valid until the inventory changes */
+	UE_API TConstArrayView<ULyraInventoryItemInstance*> GetItemsByDefinition(TSubclassOf<ULyraInventoryItemDefinition> ItemDef) const;
+
 	UFUNCTION(BlueprintCallable, Category=Inventory, BlueprintPure)
 	UE_API ULyraInventoryItemInstance* FindFirstItemStackByDefinition(TSubclassOf<ULyraInventoryItemDefinition> ItemDef) const;
 
@@ -161,7 +182,6 @@ public:
 	UE_API bool ConsumeItemsByDefinition(TSubclassOf<ULyraInventoryItemDefinition> ItemDef, int32 NumToConsume);
 
 	//~UObject interface
-	UE_API virtual bool ReplicateSubobjects(class UActorChannel* Channel, class FOutBunch* Bunch, FReplicationFlags* RepFlags) override;
 	UE_API virtual void ReadyForReplication() override;
 	//~End of UObject interface
 
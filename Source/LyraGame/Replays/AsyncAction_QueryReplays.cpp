@@ -2,9 +2,9 @@
 
 #include "Replays/AsyncAction_QueryReplays.h"
 
+#include "Engine/GameInstance.h"
 #include "GameFramework/PlayerController.h"
 #include "LyraReplaySubsystem.h"
-#include "Templates/Greater.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AsyncAction_QueryReplays)
 
@@ -28,14 +28,16 @@ UAsyncAction_QueryReplays* UAsyncAction_QueryReplays::QueryReplays(APlayerContro
 
 void UAsyncAction_QueryReplays::Activate()
 {
-	ReplayStreamer = FNetworkReplayStreaming::Get().GetFactory().CreateReplayStreamer();
-
 	ResultList = NewObject<ULyraReplayList>();
-	if (ReplayStreamer.IsValid())
-	{
-		FNetworkReplayVersion EnumerateStreamsVersion = FNetworkVersion::GetReplayVersion();
 
-		ReplayStreamer->EnumerateStreams(EnumerateStreamsVersion, INDEX_NONE, FString(), TArray<FString>(), FEnumerateStreamsCallback::CreateUObject(this, &ThisClass::OnEnumerateStreamsComplete));
+	// The replay subsystem keeps a catalog of local replays, so the replay directory doesn't need to be walked
+	APlayerController* PC = PlayerController.Get();
+	UGameInstance* GameInstance = PC ? PC->GetGameInstance() : nullptr;
+	ReplaySubsystem = GameInstance ? GameInstance->GetSubsystem<ULyraReplaySubsystem>() : nullptr;
+
+	if (ReplaySubsystem.IsValid())
+	{
+		ReplaySubsystem->WhenReplayCatalogReady(INDEX_NONE, FSimpleDelegate::CreateUObject(this, &ThisClass::OnReplayCatalogReady));
 	}
 	else
 	{
@@ -43,18 +45,21 @@ void UAsyncAction_QueryReplays::Activate()
 	}
 }
 
-void UAsyncAction_QueryReplays::OnEnumerateStreamsComplete(const FEnumerateStreamsResult& Result)
+void UAsyncAction_QueryReplays::OnReplayCatalogReady()
 {
-	for (const FNetworkReplayStreamInfo& StreamInfo : Result.FoundStreams)
+	if (const ULyraReplaySubsystem* Subsystem = ReplaySubsystem.Get())
 	{
-		ULyraReplayListEntry* NewReplayEntry = NewObject<ULyraReplayListEntry>(ResultList);
-		NewReplayEntry->StreamInfo = StreamInfo;
-		ResultList->Results.Add(NewReplayEntry);
-	}
+		// Already sorted by date
+		TArray<FNetworkReplayStreamInfo> PlayableReplays;
+		Subsystem->GetPlayableReplays(PlayableReplays);
 
-	// Sort demo names by date
-	Algo::SortBy(ResultList->Results, [](const TObjectPtr<ULyraReplayListEntry>& Data) { return Data->StreamInfo.Timestamp.GetTicks(); }, TGreater<>());
+		for (const FNetworkReplayStreamInfo& StreamInfo : PlayableReplays)
+		{
+			ULyraReplayListEntry* NewReplayEntry = NewObject<ULyraReplayListEntry>(ResultList);
+			NewReplayEntry->StreamInfo = StreamInfo;
+			ResultList->Results.Add(NewReplayEntry);
+		}
+	}
 
 	QueryComplete.Broadcast(ResultList);
 }
-
@@ -8,10 +8,9 @@
 #include "AsyncAction_QueryReplays.generated.h"
 
 class APlayerController;
-class INetworkReplayStreamer;
 class ULyraReplayList;
+class ULyraReplaySubsystem;
 class UObject;
-struct FEnumerateStreamsResult;
 struct FFrame;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FQueryReplayAsyncDelegate, ULyraReplayList*, Results);
@@ -39,7 +38,7 @@ public:
 	FQueryReplayAsyncDelegate QueryComplete;
 
 private:
-	void OnEnumerateStreamsComplete(const FEnumerateStreamsResult& Result);
+	void OnReplayCatalogReady();
 
 private:
 	UPROPERTY()
@@ -47,5 +46,5 @@ private:
 
 	TWeakObjectPtr<APlayerController> PlayerController;
 
-	TSharedPtr<INetworkReplayStreamer> ReplayStreamer;
+	TWeakObjectPtr<ULyraReplaySubsystem> ReplaySubsystem;
 };
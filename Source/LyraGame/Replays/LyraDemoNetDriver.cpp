@@ -0,0 +1,46 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Replays/LyraDemoNetDriver.h"
+
+#include "HAL/PlatformTime.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(LyraDemoNetDriver)
+
+void ULyraDemoNetDriver::TickFlush(float DeltaSeconds)
+{
+	if (!IsRecording())
+	{
+		bMeasuringCheckpoint = false;
+		Super::TickFlush(DeltaSeconds);
+		return;
+	}
+
+	const bool bWasSavingCheckpoint = IsSavingCheckpoint();
+	const double LastCheckpointTimeBefore = GetLastCheckpointTime();
+	const double StartTime = FPlatformTime::Seconds();
+
+	Super::TickFlush(DeltaSeconds);
+
+	const float ElapsedMS = (float)((FPlatformTime::Seconds() - StartTime) * 1000.0);
+	const bool bSavingCheckpoint = IsSavingCheckpoint();
+
+	// A checkpoint that finishes within the frame it starts on never shows up in IsSavingCheckpoint()
+	if (!bWasSavingCheckpoint && (bSavingCheckpoint || (GetLastCheckpointTime() != LastCheckpointTimeBefore)))
+	{
+		CurrentCheckpoint = FLyraDemoCheckpointCost();
+		CurrentCheckpoint.DemoTime = GetDemoCurrentTime();
+		bMeasuringCheckpoint = true;
+	}
+
+	if (bMeasuringCheckpoint)
+	{
+		CurrentCheckpoint.SaveTimeMS += ElapsedMS;
+		++CurrentCheckpoint.NumFrames;
+
+		if (!bSavingCheckpoint)
+		{
+			bMeasuringCheckpoint = false;
+			OnCheckpointSaved.Broadcast(CurrentCheckpoint);
+		}
+	}
+}
@@ -0,0 +1,54 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Engine/DemoNetDriver.h"
+
+#include "LyraDemoNetDriver.generated.h"
+
+#define UE_API LYRAGAME_API
+
+class UObject;
+
+/** Cost of one replay checkpoint, as measured by ULyraDemoNetDriver */
+struct FLyraDemoCheckpointCost
+{
+	// Demo time the checkpoint was started at, in seconds
+	float DemoTime = 0.0f;
+
+	// Time the driver spent ticking on the frames the checkpoint was saved over, in milliseconds
+	float SaveTimeMS = 0.0f;
+
+	// Number of frames the checkpoint was saved over, 1 if it was saved within the frame it started
+	int32 NumFrames = 0;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FLyraDemoCheckpointSavedDelegate, const FLyraDemoCheckpointCost& /*Cost*/);
+
+/**
+ * Demo net driver that measures its own checkpoints.
+ *
+ * A checkpoint save can be spread over several frames or start and finish within a single one, so it is timed from
+ * the driver's flush, where the save actually happens, instead of by watching IsSavingCheckpoint() from outside.
+ * The frame a checkpoint starts on also records a regular demo frame, which is included in its cost.
+ */
+UCLASS(MinimalAPI, transient, config=Engine)
+class ULyraDemoNetDriver : public UDemoNetDriver
+{
+	GENERATED_BODY()
+
+public:
+	//~UNetDriver interface
+	UE_API virtual void TickFlush(float DeltaSeconds) override;
+	//~End of UNetDriver interface
+
+	/** Called once a checkpoint is fully saved while recording */
+	FLyraDemoCheckpointSavedDelegate OnCheckpointSaved;
+
+private:
+	// Checkpoint that is currently being saved
+	FLyraDemoCheckpointCost CurrentCheckpoint;
+	bool bMeasuringCheckpoint = false;
+};
+
+#undef UE_API
@@ -1,13 +1,22 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "LyraReplaySubsystem.h"
+#include "Dom/JsonObject.h"
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
 #include "Engine/DemoNetDriver.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
 #include "Internationalization/Text.h"
 #include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/NetworkVersion.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
 #include "CommonUISettings.h"
 #include "ICommonUIModule.h"
+#include "Replays/LyraDemoNetDriver.h"
 #include "LyraLogChannels.h"
 #include "Player/LyraLocalPlayer.h"
 #include "Settings/LyraSettingsLocal.h"
@@ -17,10 +26,103 @@
 
 UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Platform_Trait_ReplaySupport, "Platform.Trait.ReplaySupport");
 
+namespace LyraReplays
+{
+	static const int32 CatalogFileVersion = 1;
+
+	// Number of checkpoints to keep stats for
+	static const int32 MaxCheckpointStats = 32;
+
+	// How long the recording governor waits for a requested recording to start, in seconds
+	static const float RecordingStartTimeoutSeconds = 30.0f;
+
+	static float CheckpointFrameBudgetMs = 2.0f;
+	static FAutoConsoleVariableRef CVarCheckpointFrameBudgetMs(
+		TEXT("Lyra.Replays.CheckpointFrameBudgetMs"),
+		CheckpointFrameBudgetMs,
+		TEXT("Time in milliseconds a recording client may spend saving a checkpoint per frame, the rest of the save is spread over later frames. Zero or less doesn't limit it."),
+		ECVF_Default);
+
+	static float MinCheckpointIntervalSeconds = 30.0f;
+	static FAutoConsoleVariableRef CVarMinCheckpointIntervalSeconds(
+		TEXT("Lyra.Replays.MinCheckpointIntervalSeconds"),
+		MinCheckpointIntervalSeconds,
+		TEXT("Shortest time between replay checkpoints the recording governor will pick, in seconds."),
+		ECVF_Default);
+
+	static float MaxCheckpointIntervalSeconds = 90.0f;
+	static FAutoConsoleVariableRef CVarMaxCheckpointIntervalSeconds(
+		TEXT("Lyra.Replays.MaxCheckpointIntervalSeconds"),
+		MaxCheckpointIntervalSeconds,
+		TEXT("Longest time between replay checkpoints the recording governor will pick, in seconds. Seeking gets slower the further apart checkpoints are."),
+		ECVF_Default);
+
+	static float MaxCheckpointCostPercent = 1.0f;
+	static FAutoConsoleVariableRef CVarMaxCheckpointCostPercent(
+		TEXT("Lyra.Replays.MaxCheckpointCostPercent"),
+		MaxCheckpointCostPercent,
+		TEXT("Share of the recording time, in percent, that saving checkpoints may take. Expensive checkpoints are taken less often."),
+		ECVF_Default);
+
+	static int32 MaxReplaySizeMB = 200;
+	static FAutoConsoleVariableRef CVarMaxReplaySizeMB(
+		TEXT("Lyra.Replays.MaxReplaySizeMB"),
+		MaxReplaySizeMB,
+		TEXT("Client replay recording stops once the replay file reaches this size in MB. Zero or less doesn't limit it."),
+		ECVF_Default);
+
+	static FAutoConsoleCommandWithWorldAndArgs CmdDumpCheckpointStats(
+		TEXT("Lyra.Replays.DumpCheckpointStats"),
+		TEXT("Logs the save time of the most recent checkpoints of the replay being recorded, and how much the replay file grew between them"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(
+			[](const TArray<FString>& Params, UWorld* World)
+			{
+				UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+				if (const ULyraReplaySubsystem* ReplaySubsystem = GameInstance ? GameInstance->GetSubsystem<ULyraReplaySubsystem>() : nullptr)
+				{
+					UE_LOG(LogLyra, Log, TEXT("Replay checkpoints (interval %.1fs):"), ReplaySubsystem->GetCheckpointInterval());
+					for (const FLyraReplayCheckpointStats& Stats : ReplaySubsystem->GetCheckpointStats())
+					{
+						UE_LOG(LogLyra, Log, TEXT("  at %7.1fs: %6.2f ms over %3d frames, file grew %lld bytes"), Stats.DemoTime, Stats.SaveTimeMS, Stats.NumFrames, Stats.FileGrowthBytes);
+					}
+				}
+			}));
+
+	static FAutoConsoleCommandWithWorldAndArgs CmdRebuildReplayCatalog(
+		TEXT("Lyra.Replays.RebuildCatalog"),
+		TEXT("Rebuilds the local replay catalog from the replay streamer, e.g. after replay files were changed by hand"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(
+			[](const TArray<FString>& Params, UWorld* World)
+			{
+				UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+				if (ULyraReplaySubsystem* ReplaySubsystem = GameInstance ? GameInstance->GetSubsystem<ULyraReplaySubsystem>() : nullptr)
+				{
+					ReplaySubsystem->RebuildReplayCatalog(INDEX_NONE);
+				}
+			}));
+}
+
 ULyraReplaySubsystem::ULyraReplaySubsystem()
 {
 }
 
+void ULyraReplaySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	RecordingCompleteHandle = FNetworkReplayDelegates::OnReplayRecordingComplete.AddUObject(this, &ThisClass::OnReplayRecordingComplete);
+}
+
+void ULyraReplaySubsystem::Deinitialize()
+{
+	StopRecordingGovernor();
+
+	FNetworkReplayDelegates::OnReplayRecordingComplete.Remove(RecordingCompleteHandle);
+	RecordingCompleteHandle.Reset();
+
+	Super::Deinitialize();
+}
+
 bool ULyraReplaySubsystem::DoesPlatformSupportReplays()
 {
 	if (ICommonUIModule::GetSettings().GetPlatformTraits().HasTag(GetPlatformSupportTraitTag()))
@@ -48,10 +150,19 @@ void ULyraReplaySubsystem::RecordClientReplay(APlayerController* PlayerControlle
 {
 	if (ensure(DoesPlatformSupportReplays() && PlayerController))
 	{
-		FText FriendlyNameText = FText::Format(NSLOCTEXT("Lyra", "LyraReplayName_Format", "Client Replay {0}"), FText::AsDateTime(FDateTime::UtcNow(), EDateTimeStyle::Short, EDateTimeStyle::Short));
-		GetGameInstance()->StartRecordingReplay(FString(), FriendlyNameText.ToString());
+		const FDateTime Now = FDateTime::UtcNow();
+		FText FriendlyNameText = FText::Format(NSLOCTEXT("Lyra", "LyraReplayName_Format", "Client Replay {0}"), FText::AsDateTime(Now, EDateTimeStyle::Short, EDateTimeStyle::Short));
+
+		// Name the stream ourselves so the catalog knows which file it ends up in
+		RecordingReplayName = FString::Printf(TEXT("ClientReplay_%s"), *Now.ToString());
+		GetGameInstance()->StartRecordingReplay(RecordingReplayName, FriendlyNameText.ToString());
+		StartRecordingGovernor();
 
-		if (ULyraLocalPlayer* LyraLocalPlayer = Cast<ULyraLocalPlayer>(PlayerController->GetLocalPlayer()))
+		ULocalPlayer* LocalPlayer = PlayerController->GetLocalPlayer();
+		const int32 UserIndex = LocalPlayer ? LocalPlayer->GetPlatformUserIndex() : INDEX_NONE;
+		WhenReplayCatalogReady(UserIndex, FSimpleDelegate::CreateUObject(this, &ThisClass::AddRecordingToCatalog, RecordingReplayName, FriendlyNameText.ToString()));
+
+		if (ULyraLocalPlayer* LyraLocalPlayer = Cast<ULyraLocalPlayer>(LocalPlayer))
 		{
 			// Start a cleanup of existing saved streams
 			int32 NumToKeep = LyraLocalPlayer->GetLocalSettings()->GetNumberOfReplaysToKeep();
@@ -63,25 +174,84 @@ void ULyraReplaySubsystem::RecordClientReplay(APlayerController* PlayerControlle
 void ULyraReplaySubsystem::CleanupLocalReplays(ULocalPlayer* LocalPlayer, int32 NumReplaysToKeep)
 {
 	// TODO this was only tested with the generic file streamer and may not fully work with the save game streamer
-	// This only handles one delete at a time, and will loop until it gets an error or goes below NumReplaysToKeep
-	// It does it this way because each delete may involve a server or save game query that invalidates the replay list
+	// The replays to delete are picked once from the catalog and then deleted one after another, without enumerating the streams again
 	if (LocalPlayer != nullptr && LocalPlayerDeletingReplays == nullptr && NumReplaysToKeep != 0)
 	{
 		LocalPlayerDeletingReplays = LocalPlayer;
 		DeletingReplaysNumberToKeep = NumReplaysToKeep;
 
-		CurrentReplayStreamer = FNetworkReplayStreaming::Get().GetFactory().CreateReplayStreamer();
-		if (CurrentReplayStreamer.IsValid())
+		WhenReplayCatalogReady(LocalPlayer->GetPlatformUserIndex(), FSimpleDelegate::CreateUObject(this, &ThisClass::DeleteReplaysAboveLimit));
+	}
+}
+
+void ULyraReplaySubsystem::DeleteReplaysAboveLimit()
+{
+	if (!IsValid(LocalPlayerDeletingReplays))
+	{
+		// Lost context, don't do anything
+		FinishDeletingReplays();
+		return;
+	}
+
+	// Never delete keep streams
+	TArray<const FLyraReplayCatalogEntry*> DeletableReplays;
+	for (const FLyraReplayCatalogEntry& Entry : ReplayCatalog)
+	{
+		if (!Entry.StreamInfo.bShouldKeep)
 		{
-			// Use the default version to get old version replays as well
-			FNetworkReplayVersion EnumerateStreamsVersion;
+			DeletableReplays.Add(&Entry);
+		}
+	}
+
+	// Sort by date, the replay being recorded is in the catalog as well and counts towards the limit
+	Algo::SortBy(DeletableReplays, [](const FLyraReplayCatalogEntry* Entry) { return Entry->StreamInfo.Timestamp.GetTicks(); }, TGreater<>());
 
-			CurrentReplayStreamer->EnumerateStreams(EnumerateStreamsVersion, LocalPlayer->GetPlatformUserIndex(), FString(), TArray<FString>(), FEnumerateStreamsCallback::CreateUObject(this, &ThisClass::OnEnumerateStreamsCompleteForDelete));
+	ReplaysToDelete.Reset();
+	for (int32 ReplayIndex = DeletingReplaysNumberToKeep; (ReplayIndex > 0) && (ReplayIndex < DeletableReplays.Num()); ++ReplayIndex)
+	{
+		const FNetworkReplayStreamInfo& StreamInfo = DeletableReplays[ReplayIndex]->StreamInfo;
+		if (!StreamInfo.bIsLive)
+		{
+			ReplaysToDelete.Add(StreamInfo.Name);
 		}
 	}
+
+	if (ReplaysToDelete.Num() > 0)
+	{
+		CurrentReplayStreamer = FNetworkReplayStreaming::Get().GetFactory().CreateReplayStreamer();
+	}
+
+	DeleteNextReplay();
+}
+
+void ULyraReplaySubsystem::DeleteNextReplay()
+{
+	if (!CurrentReplayStreamer.IsValid() || !IsValid(LocalPlayerDeletingReplays) || (ReplaysToDelete.Num() == 0))
+	{
+		FinishDeletingReplays();
+		return;
+	}
+
+	ReplayBeingDeleted = ReplaysToDelete.Pop(EAllowShrinking::No);
+	UE_LOG(LogLyra, Log, TEXT("LyraReplaySubsystem asked to delete replay %s"), *ReplayBeingDeleted);
+	CurrentReplayStreamer->DeleteFinishedStream(ReplayBeingDeleted, LocalPlayerDeletingReplays->GetPlatformUserIndex(), FDeleteFinishedStreamCallback::CreateUObject(this, &ThisClass::OnDeleteReplay));
 }
 
-void ULyraReplaySubsystem::OnEnumerateStreamsCompleteForDelete(const FEnumerateStreamsResult& Result)
+void ULyraReplaySubsystem::FinishDeletingReplays()
+{
+	if (CurrentReplayStreamer.IsValid())
+	{
+		SaveReplayCatalog();
+	}
+
+	ReplaysToDelete.Reset();
+	ReplayBeingDeleted.Reset();
+	CurrentReplayStreamer = nullptr;
+	LocalPlayerDeletingReplays = nullptr;
+	DeletingReplaysNumberToKeep = 0;
+}
+
+void ULyraReplaySubsystem::OnDeleteReplay(const FDeleteFinishedStreamResult& DeleteResult)
 {
 	if (!CurrentReplayStreamer.IsValid() || !IsValid(LocalPlayerDeletingReplays))
 	{
@@ -89,74 +259,487 @@ void ULyraReplaySubsystem::OnEnumerateStreamsCompleteForDelete(const FEnumerateS
 		return;
 	}
 
-	TArray<FNetworkReplayStreamInfo> StreamsToDelete;
+	// A replay that is already gone only means the catalog was out of date
+	if (DeleteResult.WasSuccessful() || (DeleteResult.Result == EStreamingOperationResult::ReplayNotFound))
+	{
+		ReplayCatalog.RemoveAll([this](const FLyraReplayCatalogEntry& Entry) { return Entry.StreamInfo.Name == ReplayBeingDeleted; });
+		DeleteNextReplay();
+	}
+	else
+	{
+		// Failed, stop trying to delete anything else
+		// TODO properly integrate with platform-specific error reporting
+		UE_LOG(LogLyra, Warning, TEXT("Failed to delete replay with error %d!"), (int32)DeleteResult.Result);
+
+		FinishDeletingReplays();
+	}
+}
+
+void ULyraReplaySubsystem::WhenReplayCatalogReady(int32 UserIndex, FSimpleDelegate Callback)
+{
+	if ((CatalogState == ECatalogState::Unloaded) && LoadReplayCatalog())
+	{
+		CatalogState = ECatalogState::Ready;
+	}
+
+	if (CatalogState == ECatalogState::Ready)
+	{
+		Callback.ExecuteIfBound();
+		return;
+	}
+
+	CatalogReadyCallbacks.Add(MoveTemp(Callback));
+
+	if (CatalogState == ECatalogState::Unloaded)
+	{
+		RebuildReplayCatalog(UserIndex);
+	}
+}
+
+void ULyraReplaySubsystem::GetPlayableReplays(TArray<FNetworkReplayStreamInfo>& OutReplays) const
+{
+	const uint32 CurrentNetworkVersion = FNetworkVersion::GetReplayVersion().NetworkVersion;
+
+	OutReplays.Reset(ReplayCatalog.Num());
+	for (const FLyraReplayCatalogEntry& Entry : ReplayCatalog)
+	{
+		if (Entry.NetworkVersion == CurrentNetworkVersion)
+		{
+			OutReplays.Add(Entry.StreamInfo);
+		}
+	}
+
+	// Sort demo names by date
+	Algo::SortBy(OutReplays, [](const FNetworkReplayStreamInfo& Data) { return Data.Timestamp.GetTicks(); }, TGreater<>());
+}
+
+void ULyraReplaySubsystem::RebuildReplayCatalog(int32 UserIndex)
+{
+	if (CatalogState == ECatalogState::Building)
+	{
+		return;
+	}
+
+	CatalogReplayStreamer = FNetworkReplayStreaming::Get().GetFactory().CreateReplayStreamer();
+	if (!CatalogReplayStreamer.IsValid())
+	{
+		// Nothing to catalog without a streamer
+		ReplayCatalog.Reset();
+		FinishBuildingCatalog();
+		return;
+	}
+
+	CatalogState = ECatalogState::Building;
+	CatalogUserIndex = UserIndex;
+
+	// Use the default version to get old version replays as well, they still need to be cleaned up
+	FNetworkReplayVersion EnumerateStreamsVersion;
+	CatalogReplayStreamer->EnumerateStreams(EnumerateStreamsVersion, CatalogUserIndex, FString(), TArray<FString>(), FEnumerateStreamsCallback::CreateUObject(this, &ThisClass::OnEnumerateStreamsCompleteForCatalog));
+}
+
+void ULyraReplaySubsystem::OnEnumerateStreamsCompleteForCatalog(const FEnumerateStreamsResult& Result)
+{
+	if (!CatalogReplayStreamer.IsValid())
+	{
+		return;
+	}
+
+	ReplayCatalog.Reset(Result.FoundStreams.Num());
 	for (const FNetworkReplayStreamInfo& StreamInfo : Result.FoundStreams)
 	{
-		// Never delete keep streams
-		if (!StreamInfo.bShouldKeep)
+		FLyraReplayCatalogEntry& Entry = ReplayCatalog.AddDefaulted_GetRef();
+		Entry.StreamInfo = StreamInfo;
+	}
+
+	// Enumerate once more with our own version to find out which of them this build can play
+	FNetworkReplayVersion EnumerateStreamsVersion = FNetworkVersion::GetReplayVersion();
+	CatalogReplayStreamer->EnumerateStreams(EnumerateStreamsVersion, CatalogUserIndex, FString(), TArray<FString>(), FEnumerateStreamsCallback::CreateUObject(this, &ThisClass::OnEnumeratePlayableStreamsCompleteForCatalog));
+}
+
+void ULyraReplaySubsystem::OnEnumeratePlayableStreamsCompleteForCatalog(const FEnumerateStreamsResult& Result)
+{
+	if (!CatalogReplayStreamer.IsValid())
+	{
+		return;
+	}
+
+	const uint32 CurrentNetworkVersion = FNetworkVersion::GetReplayVersion().NetworkVersion;
+	for (const FNetworkReplayStreamInfo& StreamInfo : Result.FoundStreams)
+	{
+		if (FLyraReplayCatalogEntry* Entry = FindCatalogEntry(StreamInfo.Name))
 		{
-			StreamsToDelete.Add(StreamInfo);
+			Entry->NetworkVersion = CurrentNetworkVersion;
 		}
 	}
 
-	// Sort by date
-	Algo::SortBy(StreamsToDelete, [](const FNetworkReplayStreamInfo& Data) { return Data.Timestamp.GetTicks(); }, TGreater<>());
+	UE_LOG(LogLyra, Log, TEXT("Built replay catalog with %d replays"), ReplayCatalog.Num());
 
-	if (UDemoNetDriver* DemoDriver = GetDemoDriver())
+	SaveReplayCatalog();
+	FinishBuildingCatalog();
+}
+
+void ULyraReplaySubsystem::FinishBuildingCatalog()
+{
+	CatalogReplayStreamer = nullptr;
+	CatalogState = ECatalogState::Ready;
+
+	TArray<FSimpleDelegate> Callbacks = MoveTemp(CatalogReadyCallbacks);
+	for (FSimpleDelegate& Callback : Callbacks)
+	{
+		Callback.ExecuteIfBound();
+	}
+}
+
+FLyraReplayCatalogEntry* ULyraReplaySubsystem::FindCatalogEntry(const FString& ReplayName)
+{
+	return ReplayCatalog.FindByPredicate([&ReplayName](const FLyraReplayCatalogEntry& Entry) { return Entry.StreamInfo.Name == ReplayName; });
+}
+
+FString ULyraReplaySubsystem::GetReplayCatalogPath()
+{
+	// Next to the replays of the local file streamer
+	return FPaths::ProjectSavedDir() / TEXT("Demos") / TEXT("ReplayCatalog.json");
+}
+
+bool ULyraReplaySubsystem::LoadReplayCatalog()
+{
+	FString CatalogString;
+	if (!FFileHelper::LoadFileToString(CatalogString, *GetReplayCatalogPath()))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> CatalogObject;
+	TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(CatalogString);
+	if (!FJsonSerializer::Deserialize(JsonReader, CatalogObject) || !CatalogObject.IsValid())
 	{
-		if (DemoDriver->IsRecording())
+		UE_LOG(LogLyra, Warning, TEXT("Failed to parse replay catalog %s, rebuilding it"), *GetReplayCatalogPath());
+		return false;
+	}
+
+	int32 FileVersion = 0;
+	if (!CatalogObject->TryGetNumberField(TEXT("Version"), FileVersion) || (FileVersion != LyraReplays::CatalogFileVersion))
+	{
+		return false;
+	}
+
+	ReplayCatalog.Reset();
+
+	const TArray<TSharedPtr<FJsonValue>>* ReplayValues = nullptr;
+	if (CatalogObject->TryGetArrayField(TEXT("Replays"), ReplayValues))
+	{
+		for (const TSharedPtr<FJsonValue>& ReplayValue : *ReplayValues)
 		{
-			// If we're recording, the live stream may or may not show up in the query which affects the keep count
-			// Add a fake live stream if the active one is missing from the results
-			if (StreamsToDelete.Num() > 0 && !StreamsToDelete[0].bIsLive)
+			const TSharedPtr<FJsonObject>* ReplayObject = nullptr;
+			if (!ReplayValue->TryGetObject(ReplayObject))
 			{
-				StreamsToDelete.Insert(FNetworkReplayStreamInfo(), 0);
+				continue;
 			}
+
+			FLyraReplayCatalogEntry& Entry = ReplayCatalog.AddDefaulted_GetRef();
+			FNetworkReplayStreamInfo& StreamInfo = Entry.StreamInfo;
+
+			FString TimestampString;
+			(*ReplayObject)->TryGetStringField(TEXT("Name"), StreamInfo.Name);
+			(*ReplayObject)->TryGetStringField(TEXT("FriendlyName"), StreamInfo.FriendlyName);
+			(*ReplayObject)->TryGetStringField(TEXT("Timestamp"), TimestampString);
+			FDateTime::ParseIso8601(*TimestampString, StreamInfo.Timestamp);
+			(*ReplayObject)->TryGetNumberField(TEXT("SizeInBytes"), StreamInfo.SizeInBytes);
+			(*ReplayObject)->TryGetNumberField(TEXT("LengthInMS"), StreamInfo.LengthInMS);
+			(*ReplayObject)->TryGetNumberField(TEXT("Changelist"), StreamInfo.Changelist);
+			(*ReplayObject)->TryGetBoolField(TEXT("ShouldKeep"), StreamInfo.bShouldKeep);
+			(*ReplayObject)->TryGetNumberField(TEXT("NetworkVersion"), Entry.NetworkVersion);
+
+			// Nothing is being recorded yet, a replay still marked as live was cut short
+			StreamInfo.bIsLive = false;
 		}
 	}
 
-	if (StreamsToDelete.Num() > DeletingReplaysNumberToKeep)
+	return true;
+}
+
+void ULyraReplaySubsystem::SaveReplayCatalog() const
+{
+	TArray<TSharedPtr<FJsonValue>> ReplayValues;
+	ReplayValues.Reserve(ReplayCatalog.Num());
+	for (const FLyraReplayCatalogEntry& Entry : ReplayCatalog)
+	{
+		const FNetworkReplayStreamInfo& StreamInfo = Entry.StreamInfo;
+
+		TSharedRef<FJsonObject> ReplayObject = MakeShared<FJsonObject>();
+		ReplayObject->SetStringField(TEXT("Name"), StreamInfo.Name);
+		ReplayObject->SetStringField(TEXT("FriendlyName"), StreamInfo.FriendlyName);
+		ReplayObject->SetStringField(TEXT("Timestamp"), StreamInfo.Timestamp.ToIso8601());
+		ReplayObject->SetNumberField(TEXT("SizeInBytes"), (double)StreamInfo.SizeInBytes);
+		ReplayObject->SetNumberField(TEXT("LengthInMS"), StreamInfo.LengthInMS);
+		ReplayObject->SetNumberField(TEXT("Changelist"), StreamInfo.Changelist);
+		ReplayObject->SetBoolField(TEXT("ShouldKeep"), StreamInfo.bShouldKeep);
+		ReplayObject->SetNumberField(TEXT("NetworkVersion"), Entry.NetworkVersion);
+		ReplayValues.Add(MakeShared<FJsonValueObject>(ReplayObject));
+	}
+
+	TSharedRef<FJsonObject> CatalogObject = MakeShared<FJsonObject>();
+	CatalogObject->SetNumberField(TEXT("Version"), LyraReplays::CatalogFileVersion);
+	CatalogObject->SetArrayField(TEXT("Replays"), ReplayValues);
+
+	FString CatalogString;
+	TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&CatalogString);
+	if (!FJsonSerializer::Serialize(CatalogObject, JsonWriter) || !FFileHelper::SaveStringToFile(CatalogString, *GetReplayCatalogPath()))
 	{
-		// Delete the first replay above the limit, if successful it won't be in the loop during the next loop
-		// If unsuccessful, it will stop looping
-		FString ReplayName = StreamsToDelete[DeletingReplaysNumberToKeep].Name;
-		UE_LOG(LogLyra, Log, TEXT("LyraReplaySubsystem asked to delete replay %s"), *ReplayName);
-		CurrentReplayStreamer->DeleteFinishedStream(ReplayName, LocalPlayerDeletingReplays->GetPlatformUserIndex(), FDeleteFinishedStreamCallback::CreateUObject(this, &ThisClass::OnDeleteReplay));
+		UE_LOG(LogLyra, Warning, TEXT("Failed to save replay catalog %s"), *GetReplayCatalogPath());
 	}
-	else
+}
+
+void ULyraReplaySubsystem::AddRecordingToCatalog(FString ReplayName, FString FriendlyName)
+{
+	FLyraReplayCatalogEntry* Entry = FindCatalogEntry(ReplayName);
+	if (Entry == nullptr)
 	{
-		// We're below the limit so stop iterating
-		CurrentReplayStreamer = nullptr;
-		LocalPlayerDeletingReplays = nullptr;
-		DeletingReplaysNumberToKeep = 0;
+		Entry = &ReplayCatalog.AddDefaulted_GetRef();
+		Entry->StreamInfo.Name = ReplayName;
+		Entry->StreamInfo.FriendlyName = FriendlyName;
+		Entry->StreamInfo.Timestamp = FDateTime::UtcNow();
 	}
+
+	const FNetworkReplayVersion ReplayVersion = FNetworkVersion::GetReplayVersion();
+	Entry->StreamInfo.Changelist = ReplayVersion.Changelist;
+	Entry->NetworkVersion = ReplayVersion.NetworkVersion;
+
+	// Only live until the recording completes, unless that already happened
+	Entry->StreamInfo.bIsLive = (ReplayName == RecordingReplayName);
+
+	SaveReplayCatalog();
 }
 
-void ULyraReplaySubsystem::OnDeleteReplay(const FDeleteFinishedStreamResult& DeleteResult)
+void ULyraReplaySubsystem::OnReplayRecordingComplete(UWorld* World)
 {
-	if (!CurrentReplayStreamer.IsValid() || !IsValid(LocalPlayerDeletingReplays))
+	if (RecordingReplayName.IsEmpty() || (World == nullptr) || (World->GetGameInstance() != GetGameInstance()))
 	{
-		// Lost context, don't do anything
 		return;
 	}
 
-	if (DeleteResult.WasSuccessful())
+	StopRecordingGovernor();
+
+	const FString ReplayName = MoveTemp(RecordingReplayName);
+	RecordingReplayName.Reset();
+
+	// If the catalog isn't ready yet the entry is added once it is
+	if (FLyraReplayCatalogEntry* Entry = (CatalogState == ECatalogState::Ready) ? FindCatalogEntry(ReplayName) : nullptr)
+	{
+		Entry->StreamInfo.bIsLive = false;
+
+		if (UDemoNetDriver* DemoDriver = World->GetDemoNetDriver())
+		{
+			Entry->StreamInfo.LengthInMS = FMath::RoundToInt32(DemoDriver->GetDemoTotalTime() * 1000.0f);
+		}
+
+		// Only the local file streamer writes a file we know the location of
+		const int64 FileSize = IFileManager::Get().FileSize(*GetLocalReplayFilePath(ReplayName));
+		Entry->StreamInfo.SizeInBytes = FMath::Max<int64>(FileSize, 0);
+
+		SaveReplayCatalog();
+	}
+}
+
+FString ULyraReplaySubsystem::GetLocalReplayFilePath(const FString& ReplayName)
+{
+	return FPaths::ProjectSavedDir() / TEXT("Demos") / (ReplayName + TEXT(".replay"));
+}
+
+void FLyraReplayCVarOverride::Begin(const TCHAR* Name, const FString& Value)
+{
+	End();
+
+	CVarName = Name;
+	IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(Name);
+	if (CVar == nullptr)
 	{
-		// Enumerate list again to see if we're under the limit yet
-		FNetworkReplayVersion EnumerateStreamsVersion;
+		return;
+	}
 
-		CurrentReplayStreamer->EnumerateStreams(EnumerateStreamsVersion, LocalPlayerDeletingReplays->GetPlatformUserIndex(), FString(), TArray<FString>(), FEnumerateStreamsCallback::CreateUObject(this, &ThisClass::OnEnumerateStreamsCompleteForDelete));
+	// Setting it with a lower priority would be ignored anyway, and whoever set it from the console wants it that way
+	const uint32 SetBy = (uint32)CVar->GetFlags() & ECVF_SetByMask;
+	if (SetBy > (uint32)ECVF_SetByCode)
+	{
+		UE_LOG(LogLyra, Log, TEXT("Not overriding %s while recording replays, it was set with a higher priority"), Name);
+		return;
 	}
-	else
+
+	SavedValue = CVar->GetString();
+	SavedSetBy = SetBy;
+	bOverridden = true;
+	CVar->Set(*Value, ECVF_SetByCode);
+}
+
+void FLyraReplayCVarOverride::Update(const FString& Value)
+{
+	if (IConsoleVariable* CVar = FindOverriddenCVar())
 	{
-		// Failed, stop trying to delete anything else
-		// TODO properly integrate with platform-specific error reporting
-		UE_LOG(LogLyra, Warning, TEXT("Failed to delete replay with error %d!"), (int32)DeleteResult.Result);
+		CVar->Set(*Value, ECVF_SetByCode);
+	}
+}
 
-		CurrentReplayStreamer = nullptr;
-		LocalPlayerDeletingReplays = nullptr;
-		DeletingReplaysNumberToKeep = 0;
+void FLyraReplayCVarOverride::End()
+{
+	if (IConsoleVariable* CVar = FindOverriddenCVar())
+	{
+		// Set the value back, then lower the priority to what it was so it can be set the way it could before
+		CVar->Set(*SavedValue, ECVF_SetByCode);
+		CVar->SetFlags((EConsoleVariableFlags)(((uint32)CVar->GetFlags() & ~(uint32)ECVF_SetByMask) | SavedSetBy));
 	}
+
+	SavedValue.Reset();
+	SavedSetBy = 0;
+	bOverridden = false;
+}
+
+IConsoleVariable* FLyraReplayCVarOverride::FindOverriddenCVar() const
+{
+	IConsoleVariable* CVar = bOverridden ? IConsoleManager::Get().FindConsoleVariable(CVarName) : nullptr;
+
+	// Once it was set with a higher priority it isn't ours anymore
+	if ((CVar != nullptr) && (((uint32)CVar->GetFlags() & ECVF_SetByMask) > (uint32)ECVF_SetByCode))
+	{
+		return nullptr;
+	}
+	return CVar;
+}
+
+void ULyraReplaySubsystem::StartRecordingGovernor()
+{
+	StopRecordingGovernor();
+
+	CheckpointStats.Reset();
+	SizeAtLastCheckpoint = 0;
+	TimeUntilSizeCheck = 0.0f;
+	TimeWaitingForRecording = 0.0f;
+
+	// A negative override would make the engine fall back to its own setting instead of not limiting the save
+	const float FrameBudgetMs = FMath::Max(LyraReplays::CheckpointFrameBudgetMs, 0.0f);
+	CheckpointSaveMaxMSOverride.Begin(TEXT("demo.CheckpointSaveMaxMSPerFrameOverride"), FString::SanitizeFloat(FrameBudgetMs));
+
+	CheckpointIntervalSeconds = LyraReplays::MinCheckpointIntervalSeconds;
+	CheckpointUploadDelayOverride.Begin(TEXT("demo.CheckpointUploadDelayInSeconds"), FString::SanitizeFloat(CheckpointIntervalSeconds));
+
+	GovernorTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ThisClass::TickRecordingGovernor), 0.0f);
+}
+
+void ULyraReplaySubsystem::StopRecordingGovernor()
+{
+	if (!GovernorTickHandle.IsValid())
+	{
+		return;
+	}
+
+	FTSTicker::GetCoreTicker().RemoveTicker(GovernorTickHandle);
+	GovernorTickHandle.Reset();
+
+	SetGovernedDemoDriver(nullptr);
+
+	// Hand the engine settings back
+	CheckpointSaveMaxMSOverride.End();
+	CheckpointUploadDelayOverride.End();
+}
+
+bool ULyraReplaySubsystem::TickRecordingGovernor(float DeltaTime)
+{
+	UDemoNetDriver* DemoDriver = GetDemoDriver();
+	if ((DemoDriver == nullptr) || !DemoDriver->IsRecording())
+	{
+		// Completion is handled by OnReplayRecordingComplete, but don't keep the engine settings overridden if recording never starts
+		TimeWaitingForRecording += DeltaTime;
+		if (TimeWaitingForRecording > LyraReplays::RecordingStartTimeoutSeconds)
+		{
+			UE_LOG(LogLyra, Warning, TEXT("Replay %s isn't being recorded after %.0f seconds, stopping the recording governor"), *RecordingReplayName, LyraReplays::RecordingStartTimeoutSeconds);
+			StopRecordingGovernor();
+		}
+		return true;
+	}
+
+	TimeWaitingForRecording = 0.0f;
+	SetGovernedDemoDriver(DemoDriver);
+
+	// Checking the file size is a file system query, so only do it every now and then
+	TimeUntilSizeCheck -= DeltaTime;
+	if ((TimeUntilSizeCheck <= 0.0f) && (LyraReplays::MaxReplaySizeMB > 0))
+	{
+		TimeUntilSizeCheck = 1.0f;
+
+		const int64 FileSize = IFileManager::Get().FileSize(*GetLocalReplayFilePath(RecordingReplayName));
+		const int64 MaxFileSize = (int64)LyraReplays::MaxReplaySizeMB * 1024 * 1024;
+		if (FileSize > MaxFileSize)
+		{
+			UE_LOG(LogLyra, Warning, TEXT("Replay %s reached %lld bytes, the limit is %d MB. Stopping the recording."), *RecordingReplayName, FileSize, LyraReplays::MaxReplaySizeMB);
+			GetGameInstance()->StopRecordingReplay();
+			StopRecordingGovernor();
+		}
+	}
+
+	return true;
+}
+
+void ULyraReplaySubsystem::SetGovernedDemoDriver(UDemoNetDriver* DemoDriver)
+{
+	if (GovernedDemoDriver.Get() == DemoDriver)
+	{
+		return;
+	}
+
+	if (ULyraDemoNetDriver* OldDemoDriver = Cast<ULyraDemoNetDriver>(GovernedDemoDriver.Get()))
+	{
+		OldDemoDriver->OnCheckpointSaved.Remove(CheckpointSavedHandle);
+	}
+	CheckpointSavedHandle.Reset();
+
+	GovernedDemoDriver = DemoDriver;
+
+	if (ULyraDemoNetDriver* LyraDemoDriver = Cast<ULyraDemoNetDriver>(DemoDriver))
+	{
+		CheckpointSavedHandle = LyraDemoDriver->OnCheckpointSaved.AddUObject(this, &ThisClass::OnCheckpointSaved);
+	}
+	else if (DemoDriver != nullptr)
+	{
+		UE_LOG(LogLyra, Warning, TEXT("Replay %s is recorded by %s instead of a LyraDemoNetDriver, checkpoints can't be measured so only the size limit applies"),
+			*RecordingReplayName, *GetNameSafe(DemoDriver->GetClass()));
+	}
+}
+
+void ULyraReplaySubsystem::OnCheckpointSaved(const FLyraDemoCheckpointCost& Cost)
+{
+	FLyraReplayCheckpointStats& Stats = CheckpointStats.AddDefaulted_GetRef();
+	Stats.DemoTime = Cost.DemoTime;
+	Stats.SaveTimeMS = Cost.SaveTimeMS;
+	Stats.NumFrames = Cost.NumFrames;
+
+	const int64 FileSize = IFileManager::Get().FileSize(*GetLocalReplayFilePath(RecordingReplayName));
+	if (FileSize >= 0)
+	{
+		Stats.FileGrowthBytes = FileSize - SizeAtLastCheckpoint;
+		SizeAtLastCheckpoint = FileSize;
+	}
+
+	// Take checkpoints just often enough to keep their cost under the allowed share of the recording time
+	const float CostShare = FMath::Max(LyraReplays::MaxCheckpointCostPercent, UE_KINDA_SMALL_NUMBER) * 0.01f;
+	const float DesiredInterval = (Stats.SaveTimeMS * 0.001f) / CostShare;
+
+	// Blend towards it, a single slow checkpoint (e.g. during a hitch) shouldn't swing the interval
+	SetCheckpointInterval(FMath::Lerp(CheckpointIntervalSeconds, DesiredInterval, 0.5f));
+
+	UE_LOG(LogLyra, Verbose, TEXT("Replay checkpoint at %.1fs took %.2f ms over %d frames, file grew %lld bytes. Next interval %.1fs"),
+		Stats.DemoTime, Stats.SaveTimeMS, Stats.NumFrames, Stats.FileGrowthBytes, CheckpointIntervalSeconds);
+
+	if (CheckpointStats.Num() > LyraReplays::MaxCheckpointStats)
+	{
+		CheckpointStats.RemoveAt(0, 1, EAllowShrinking::No);
+	}
+}
+
+void ULyraReplaySubsystem::SetCheckpointInterval(float IntervalSeconds)
+{
+	const float MinInterval = LyraReplays::MinCheckpointIntervalSeconds;
+	CheckpointIntervalSeconds = FMath::Clamp(IntervalSeconds, MinInterval, FMath::Max(MinInterval, LyraReplays::MaxCheckpointIntervalSeconds));
+
+	CheckpointUploadDelayOverride.Update(FString::SanitizeFloat(CheckpointIntervalSeconds));
 }
 
 void ULyraReplaySubsystem::SeekInActiveReplay(float TimeInSeconds)
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "Containers/Ticker.h"
 #include "NetworkReplayStreaming.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "GameplayTagContainer.h"
@@ -10,10 +11,13 @@
 
 #define UE_API LYRAGAME_API
 
+class IConsoleVariable;
 class UDemoNetDriver;
 class APlayerController;
 class ULocalPlayer;
+class UWorld;
 struct FFrame;
+struct FLyraDemoCheckpointCost;
 
 /** An available replay for display in the UI */
 UCLASS(MinimalAPI, BlueprintType)
@@ -56,6 +60,53 @@ public:
 	TArray<TObjectPtr<ULyraReplayListEntry>> Results;
 };
 
+/** A replay in the local replay catalog */
+struct FLyraReplayCatalogEntry
+{
+	FNetworkReplayStreamInfo StreamInfo;
+
+	// Network version of the build that recorded the replay, zero if it isn't playable by this build
+	uint32 NetworkVersion = 0;
+};
+
+/** Timing and size of a checkpoint saved while recording a replay */
+struct FLyraReplayCheckpointStats
+{
+	// Demo time the checkpoint was taken at, in seconds
+	float DemoTime = 0.0f;
+
+	// Time the demo driver spent on the frames the checkpoint was saved over
+	float SaveTimeMS = 0.0f;
+
+	// Number of frames the save was spread over
+	int32 NumFrames = 0;
+
+	// How much the replay file grew since the previous checkpoint, -1 if the streamer doesn't write a local file.
+	// The streamer writes asynchronously, so this is the growth between two of its writes and includes stream data.
+	int64 FileGrowthBytes = -1;
+};
+
+/** Engine console variable the replay subsystem overrides while recording, restored with its previous value and priority */
+struct FLyraReplayCVarOverride
+{
+	// Applies the value unless the variable was set with a higher priority than code, e.g. from the console
+	void Begin(const TCHAR* Name, const FString& Value);
+
+	// Changes the value if the override is still in effect
+	void Update(const FString& Value);
+
+	// Hands the variable back, unless it was set with a higher priority in the meantime
+	void End();
+
+private:
+	const TCHAR* CVarName = nullptr;
+	FString SavedValue;
+	uint32 SavedSetBy = 0;
+	bool bOverridden = false;
+
+	IConsoleVariable* FindOverriddenCVar() const;
+};
+
 /** Subsystem to handle recording/loading replays */
 UCLASS(MinimalAPI)
 class ULyraReplaySubsystem : public UGameInstanceSubsystem
@@ -65,6 +116,11 @@ class ULyraReplaySubsystem : public UGameInstanceSubsystem
 public:
 	UE_API ULyraReplaySubsystem();
 
+	//~USubsystem interface
+	UE_API virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	UE_API virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
 	/** Returns true if this platform supports replays at all */
 	UFUNCTION(BlueprintCallable, Category = Replays, BlueprintPure = false)
 	static UE_API bool DoesPlatformSupportReplays();
@@ -84,6 +140,19 @@ public:
 	UFUNCTION(BlueprintCallable, Category = Replays)
 	UE_API void CleanupLocalReplays(ULocalPlayer* LocalPlayer, int32 NumReplaysToKeep);
 
+	/**
+	 * Calls back once the local replay catalog is available.
+	 * The catalog is read from disk, and only built from the replay streamer if there is no catalog file yet.
+	 * The callback may be executed immediately.
+	 */
+	UE_API void WhenReplayCatalogReady(int32 UserIndex, FSimpleDelegate Callback);
+
+	/** Returns the catalogued replays this build can play, newest first */
+	UE_API void GetPlayableReplays(TArray<FNetworkReplayStreamInfo>& OutReplays) const;
+
+	/** Throws away the catalog and builds it again from the replay streamer */
+	UE_API void RebuildReplayCatalog(int32 UserIndex);
+
 	/** Move forward or back in currently playing replay */
 	UFUNCTION(BlueprintCallable, Category=Replays)
 	UE_API void SeekInActiveReplay(float TimeInSeconds);
@@ -96,7 +165,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category=Replays, BlueprintPure=false)
 	UE_API float GetReplayCurrentTime() const;
 
+	/** Returns the stats of the most recent checkpoints of the replay being recorded, oldest first */
+	const TArray<FLyraReplayCheckpointStats>& GetCheckpointStats() const { return CheckpointStats; }
+
+	/** Returns the checkpoint interval the recording governor currently uses, in seconds */
+	float GetCheckpointInterval() const { return CheckpointIntervalSeconds; }
+
 private:
+	enum class ECatalogState : uint8
+	{
+		Unloaded,
+		Building,
+		Ready
+	};
+
 	TSharedPtr<INetworkReplayStreamer> CurrentReplayStreamer;
 
 	UPROPERTY()
@@ -104,10 +186,74 @@ private:
 
 	int32 DeletingReplaysNumberToKeep;
 
+	// Replays picked for deletion by the current cleanup, deleted one after another
+	TArray<FString> ReplaysToDelete;
+
+	// Replay the streamer is currently deleting
+	FString ReplayBeingDeleted;
+
+	// Known replays, kept in sync with the catalog file
+	TArray<FLyraReplayCatalogEntry> ReplayCatalog;
+
+	ECatalogState CatalogState = ECatalogState::Unloaded;
+
+	// Callbacks waiting for the catalog to be built
+	TArray<FSimpleDelegate> CatalogReadyCallbacks;
+
+	TSharedPtr<INetworkReplayStreamer> CatalogReplayStreamer;
+
+	int32 CatalogUserIndex = INDEX_NONE;
+
+	// Name of the replay this subsystem is recording
+	FString RecordingReplayName;
+
+	FDelegateHandle RecordingCompleteHandle;
+
+	// Ticks while recording, adapts checkpoint settings and enforces the size limit
+	FTSTicker::FDelegateHandle GovernorTickHandle;
+
+	TArray<FLyraReplayCheckpointStats> CheckpointStats;
+
+	// Demo driver whose checkpoints are measured
+	TWeakObjectPtr<UDemoNetDriver> GovernedDemoDriver;
+	FDelegateHandle CheckpointSavedHandle;
+
+	int64 SizeAtLastCheckpoint = 0;
+	float TimeUntilSizeCheck = 0.0f;
+	float TimeWaitingForRecording = 0.0f;
+	float CheckpointIntervalSeconds = 0.0f;
+
+	// Engine checkpoint settings, overridden while recording
+	FLyraReplayCVarOverride CheckpointUploadDelayOverride;
+	FLyraReplayCVarOverride CheckpointSaveMaxMSOverride;
+
 	UDemoNetDriver* GetDemoDriver() const;
 
-	void OnEnumerateStreamsCompleteForDelete(const FEnumerateStreamsResult& Result);
+	void DeleteReplaysAboveLimit();
+	void DeleteNextReplay();
+	void FinishDeletingReplays();
 	void OnDeleteReplay(const FDeleteFinishedStreamResult& DeleteResult);
+
+	static FString GetReplayCatalogPath();
+	bool LoadReplayCatalog();
+	void SaveReplayCatalog() const;
+	FLyraReplayCatalogEntry* FindCatalogEntry(const FString& ReplayName);
+	void FinishBuildingCatalog();
+
+	void OnEnumerateStreamsCompleteForCatalog(const FEnumerateStreamsResult& Result);
+	void OnEnumeratePlayableStreamsCompleteForCatalog(const FEnumerateStreamsResult& Result);
+
+	void AddRecordingToCatalog(FString ReplayName, FString FriendlyName);
+	void OnReplayRecordingComplete(UWorld* World);
+
+	static FString GetLocalReplayFilePath(const FString& ReplayName);
+
+	void StartRecordingGovernor();
+	void StopRecordingGovernor();
+	bool TickRecordingGovernor(float DeltaTime);
+	void SetGovernedDemoDriver(UDemoNetDriver* DemoDriver);
+	void OnCheckpointSaved(const FLyraDemoCheckpointCost& Cost);
+	void SetCheckpointInterval(float IntervalSeconds);
 };
 
 #undef UE_API
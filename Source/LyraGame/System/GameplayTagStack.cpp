@@ -17,6 +17,12 @@ FString FGameplayTagStack::GetDebugString() const
 //////////////////////////////////////////////////////////////////////
 // FGameplayTagStackContainer
 
+namespace GameplayTagStackContainer
+{
+	// Empty stacks are compacted once there are more than this many and they make up at least half the array
+	static constexpr int32 MinEmptyStacksToCompact = 8;
+}
+
 void FGameplayTagStackContainer::AddStack(FGameplayTag Tag, int32 StackCount)
 {
 	if (!Tag.IsValid())
@@ -25,85 +31,163 @@ void FGameplayTagStackContainer::AddStack(FGameplayTag Tag, int32 StackCount)
 		return;
 	}
 
-	if (StackCount > 0)
+	AddStackInternal(Tag, StackCount);
+}
+
+void FGameplayTagStackContainer::RemoveStack(FGameplayTag Tag, int32 StackCount)
+{
+	if (!Tag.IsValid())
 	{
-		for (FGameplayTagStack& Stack : Stacks)
+		FFrame::KismetExecutionMessage(TEXT("An invalid tag was passed to RemoveStack"), ELogVerbosity::Warning);
+		return;
+	}
+
+	RemoveStackInternal(Tag, StackCount);
+	CompactEmptyStacks();
+}
+
+void FGameplayTagStackContainer::AddStacks(TConstArrayView<TPair<FGameplayTag, int32>> TagCounts)
+{
+	for (const TPair<FGameplayTag, int32>& TagCount : TagCounts)
+	{
+		if (!TagCount.Key.IsValid())
 		{
-			if (Stack.Tag == Tag)
-			{
-				const int32 NewCount = Stack.StackCount + StackCount;
-				Stack.StackCount = NewCount;
-				TagToCountMap[Tag] = NewCount;
-				MarkItemDirty(Stack);
-				return;
-			}
+			FFrame::KismetExecutionMessage(TEXT("An invalid tag was passed to AddStacks"), ELogVerbosity::Warning);
+			continue;
 		}
 
-		FGameplayTagStack& NewStack = Stacks.Emplace_GetRef(Tag, StackCount);
-		MarkItemDirty(NewStack);
-		TagToCountMap.Add(Tag, StackCount);
+		AddStackInternal(TagCount.Key, TagCount.Value);
 	}
 }
 
-void FGameplayTagStackContainer::RemoveStack(FGameplayTag Tag, int32 StackCount)
+void FGameplayTagStackContainer::RemoveStacks(TConstArrayView<TPair<FGameplayTag, int32>> TagCounts)
 {
-	if (!Tag.IsValid())
+	for (const TPair<FGameplayTag, int32>& TagCount : TagCounts)
 	{
-		FFrame::KismetExecutionMessage(TEXT("An invalid tag was passed to RemoveStack"), ELogVerbosity::Warning);
-		return;
+		if (!TagCount.Key.IsValid())
+		{
+			FFrame::KismetExecutionMessage(TEXT("An invalid tag was passed to RemoveStacks"), ELogVerbosity::Warning);
+			continue;
+		}
+
+		RemoveStackInternal(TagCount.Key, TagCount.Value);
+	}
+
+	CompactEmptyStacks();
+}
+
+int32 FGameplayTagStackContainer::FindStackIndex(FGameplayTag Tag) const
+{
+	if (bIndexDirty)
+	{
+		RebuildIndex();
+	}
+
+	const int32* IndexPtr = TagToIndexMap.Find(Tag);
+	return (IndexPtr != nullptr) ? *IndexPtr : INDEX_NONE;
+}
+
+void FGameplayTagStackContainer::AddStackInternal(FGameplayTag Tag, int32 StackCount)
+{
+	if (StackCount > 0)
+	{
+		const int32 Index = FindStackIndex(Tag);
+		if (Index != INDEX_NONE)
+		{
+			FGameplayTagStack& Stack = Stacks[Index];
+			if (Stack.StackCount == 0)
+			{
+				--NumEmptyStacks;
+			}
+			Stack.StackCount += StackCount;
+			MarkItemDirty(Stack);
+			return;
+		}
+
+		const int32 NewIndex = Stacks.Emplace(Tag, StackCount);
+		MarkItemDirty(Stacks[NewIndex]);
+		TagToIndexMap.Add(Tag, NewIndex);
 	}
+}
 
+void FGameplayTagStackContainer::RemoveStackInternal(FGameplayTag Tag, int32 StackCount)
+{
 	//@TODO: Should we error if you try to remove a stack that doesn't exist or has a smaller count?
 	if (StackCount > 0)
 	{
-		for (auto It = Stacks.CreateIterator(); It; ++It)
+		const int32 Index = FindStackIndex(Tag);
+		if ((Index != INDEX_NONE) && (Stacks[Index].StackCount > 0))
 		{
-			FGameplayTagStack& Stack = *It;
-			if (Stack.Tag == Tag)
+			FGameplayTagStack& Stack = Stacks[Index];
+			if (Stack.StackCount <= StackCount)
 			{
-				if (Stack.StackCount <= StackCount)
-				{
-					It.RemoveCurrent();
-					TagToCountMap.Remove(Tag);
-					MarkArrayDirty();
-				}
-				else
-				{
-					const int32 NewCount = Stack.StackCount - StackCount;
-					Stack.StackCount = NewCount;
-					TagToCountMap[Tag] = NewCount;
-					MarkItemDirty(Stack);
-				}
-				return;
+				// Keep the slot so the removal only replicates this item instead of rebuilding the whole array
+				Stack.StackCount = 0;
+				++NumEmptyStacks;
 			}
+			else
+			{
+				Stack.StackCount -= StackCount;
+			}
+			MarkItemDirty(Stack);
 		}
 	}
 }
 
-void FGameplayTagStackContainer::PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize)
+void FGameplayTagStackContainer::CompactEmptyStacks()
 {
-	for (int32 Index : RemovedIndices)
+	if ((NumEmptyStacks <= GameplayTagStackContainer::MinEmptyStacksToCompact) || (NumEmptyStacks * 2 < Stacks.Num()))
 	{
-		const FGameplayTag Tag = Stacks[Index].Tag;
-		TagToCountMap.Remove(Tag);
+		return;
 	}
+
+	for (int32 Index = Stacks.Num() - 1; Index >= 0; --Index)
+	{
+		if (Stacks[Index].StackCount == 0)
+		{
+			Stacks.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		}
+	}
+
+	NumEmptyStacks = 0;
+	MarkArrayDirty();
+	RebuildIndex();
 }
 
-void FGameplayTagStackContainer::PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize)
+void FGameplayTagStackContainer::RebuildIndex() const
 {
-	for (int32 Index : AddedIndices)
+	TagToIndexMap.Reset();
+	for (int32 Index = 0; Index < Stacks.Num(); ++Index)
 	{
-		const FGameplayTagStack& Stack = Stacks[Index];
-		TagToCountMap.Add(Stack.Tag, Stack.StackCount);
+		TagToIndexMap.Add(Stacks[Index].Tag, Index);
 	}
+	bIndexDirty = false;
+}
+
+void FGameplayTagStackContainer::PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize)
+{
+	// Removed items are swapped out of the array after this, so every index may move
+	bIndexDirty = true;
+}
+
+void FGameplayTagStackContainer::PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize)
+{
+	bIndexDirty = true;
 }
 
 void FGameplayTagStackContainer::PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize)
 {
-	for (int32 Index : ChangedIndices)
+	// Counts are read straight from Stacks, so only a changed tag needs the index rebuilt
+	if (!bIndexDirty)
 	{
-		const FGameplayTagStack& Stack = Stacks[Index];
-		TagToCountMap[Stack.Tag] = Stack.StackCount;
+		for (int32 Index : ChangedIndices)
+		{
+			const int32* IndexPtr = TagToIndexMap.Find(Stacks[Index].Tag);
+			if ((IndexPtr == nullptr) || (*IndexPtr != Index))
+			{
+				bIndexDirty = true;
+				break;
+			}
+		}
 	}
 }
-
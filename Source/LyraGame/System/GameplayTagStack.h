@@ -39,7 +39,13 @@ private:
 	int32 StackCount = 0;
 };
 
-/** Container of gameplay tag stacks */
+/**
+ * Container of gameplay tag stacks
+ *
+ * Stacks are found through a tag to index map. Fully removed stacks are kept with a count of 0 so the removal
+ * replicates as a single item change and the slot is reused if the tag comes back, they are swap-removed in
+ * one array rebuild once enough of them pile up.
+ */
 USTRUCT(BlueprintType)
 struct FGameplayTagStackContainer : public FFastArraySerializer
 {
@@ -57,16 +63,24 @@ public:
 	// Removes a specified number of stacks from the tag (does nothing if StackCount is below 1)
 	void RemoveStack(FGameplayTag Tag, int32 StackCount);
 
+	// Adds stacks to several tags at once (entries with a count below 1 are skipped)
+	void AddStacks(TConstArrayView<TPair<FGameplayTag, int32>> TagCounts);
+
+	// Removes stacks from several tags at once, compacting removed stacks at most once (entries with a count below 1 are skipped)
+	void RemoveStacks(TConstArrayView<TPair<FGameplayTag, int32>> TagCounts);
+
 	// Returns the stack count of the specified tag (or 0 if the tag is not present)
 	int32 GetStackCount(FGameplayTag Tag) const
 	{
-		return TagToCountMap.FindRef(Tag);
+		const int32 Index = FindStackIndex(Tag);
+		return (Index != INDEX_NONE) ? Stacks[Index].StackCount : 0;
 	}
 
 	// Returns true if there is at least one stack of the specified tag
 	bool ContainsTag(FGameplayTag Tag) const
 	{
-		return TagToCountMap.Contains(Tag);
+		const int32 Index = FindStackIndex(Tag);
+		return (Index != INDEX_NONE) && (Stacks[Index].StackCount > 0);
 	}
 
 	//~FFastArraySerializer contract
@@ -81,12 +95,27 @@ public:
 	}
 
 private:
-	// Replicated list of gameplay tag stacks
+	int32 FindStackIndex(FGameplayTag Tag) const;
+
+	void AddStackInternal(FGameplayTag Tag, int32 StackCount);
+	void RemoveStackInternal(FGameplayTag Tag, int32 StackCount);
+
+	// Swap-removes empty stacks once there are enough of them to be worth a full array rebuild
+	void CompactEmptyStacks();
+
+	void RebuildIndex() const;
+
+private:
+	// Replicated list of gameplay tag stacks, a count of 0 marks a removed stack waiting for compaction
 	UPROPERTY()
 	TArray<FGameplayTagStack> Stacks;
 	
-	// Accelerated list of tag stacks for queries
-	TMap<FGameplayTag, int32> TagToCountMap;
+	// Index into Stacks for each tag, rebuilt lazily after replication reorders the array
+	mutable TMap<FGameplayTag, int32> TagToIndexMap;
+	mutable bool bIndexDirty = false;
+
+	// Number of entries in Stacks with a count of 0
+	int32 NumEmptyStacks = 0;
 };
 
 template<>
@@ -0,0 +1,12 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LyraClientOnlyComponentInterface.h"
+
+#include "Components/ActorComponent.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(LyraClientOnlyComponentInterface)
+
+bool ILyraClientOnlyComponentInterface::IsClientOnlyComponent(const UActorComponent* Component)
+{
+	return (Component != nullptr) && Component->GetClass()->ImplementsInterface(ULyraClientOnlyComponentInterface::StaticClass());
+}
@@ -0,0 +1,36 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "UObject/Interface.h"
+
+#include "LyraClientOnlyComponentInterface.generated.h"
+
+#define UE_API LYRAGAME_API
+
+class UActorComponent;
+class UObject;
+
+/**
+ * Marks a component class as purely cosmetic.
+ *
+ * On dedicated servers ULyraClientOnlyComponentSubsystem destroys implementers owned by modular actors before they
+ * begin play, nothing else is needed for that. Implementers should also return false from NeedsLoadForServer() so
+ * cooked servers don't load their templates in the first place.
+ */
+UINTERFACE(MinimalAPI, meta=(CannotImplementInterfaceInBlueprint))
+class ULyraClientOnlyComponentInterface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+class ILyraClientOnlyComponentInterface
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns true if the component's class is marked as client-only */
+	static UE_API bool IsClientOnlyComponent(const UActorComponent* Component);
+};
+
+#undef UE_API
@@ -0,0 +1,190 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LyraClientOnlyComponentSubsystem.h"
+
+#include "Components/AudioComponent.h"
+#include "Components/GameFrameworkComponentManager.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "LyraLogChannels.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "System/LyraClientOnlyComponentInterface.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(LyraClientOnlyComponentSubsystem)
+
+namespace LyraClientOnlyComponents
+{
+	static bool bStripClientOnlyComponents = true;
+	static FAutoConsoleVariableRef CVarStripClientOnlyComponents(
+		TEXT("Lyra.Server.StripClientOnlyComponents"),
+		bStripClientOnlyComponents,
+		TEXT("If true, components marked as client-only destroy themselves on dedicated servers before they begin play."),
+		ECVF_Default);
+
+	static FAutoConsoleCommandWithWorldAndArgs CmdAuditCosmeticWork(
+		TEXT("Lyra.Server.AuditCosmetics"),
+		TEXT("Lists cosmetic components that are still alive or running in the world, grouped by class"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(
+			[](const TArray<FString>& Params, UWorld* World)
+			{
+				ULyraClientOnlyComponentSubsystem::AuditCosmeticWork(World);
+			}));
+}
+
+//////////////////////////////////////////////////////////////////////
+// ULyraClientOnlyComponentSubsystem
+
+bool ULyraClientOnlyComponentSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void ULyraClientOnlyComponentSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	UWorld* World = GetWorld();
+	if ((World != nullptr) && World->IsGameWorld())
+	{
+		if (UGameFrameworkComponentManager* ComponentManager = UGameInstance::GetSubsystem<UGameFrameworkComponentManager>(World->GetGameInstance()))
+		{
+			ExtensionHandlerHandle = ComponentManager->AddExtensionHandler(AActor::StaticClass(),
+				UGameFrameworkComponentManager::FExtensionHandlerDelegate::CreateUObject(this, &ThisClass::HandleActorExtension));
+		}
+	}
+}
+
+void ULyraClientOnlyComponentSubsystem::Deinitialize()
+{
+	ExtensionHandlerHandle.Reset();
+
+	Super::Deinitialize();
+}
+
+void ULyraClientOnlyComponentSubsystem::HandleActorExtension(AActor* Actor, FName EventName)
+{
+	if ((Actor == nullptr) || (Actor->GetWorld() != GetWorld()) ||
+		(EventName == UGameFrameworkComponentManager::NAME_ExtensionRemoved) ||
+		(EventName == UGameFrameworkComponentManager::NAME_ReceiverRemoved))
+	{
+		return;
+	}
+
+	TInlineComponentArray<UActorComponent*> Components(Actor);
+	for (UActorComponent* Component : Components)
+	{
+		StripIfDedicatedServer(Component);
+	}
+}
+
+bool ULyraClientOnlyComponentSubsystem::StripIfDedicatedServer(UActorComponent* Component)
+{
+	if (!LyraClientOnlyComponents::bStripClientOnlyComponents ||
+		!ILyraClientOnlyComponentInterface::IsClientOnlyComponent(Component) ||
+		!Component->IsNetMode(NM_DedicatedServer) ||
+		Component->IsBeingDestroyed())
+	{
+		return false;
+	}
+
+	if (ULyraClientOnlyComponentSubsystem* Subsystem = UWorld::GetSubsystem<ULyraClientOnlyComponentSubsystem>(Component->GetWorld()))
+	{
+		Subsystem->StrippedComponentCounts.FindOrAdd(Component->GetClass()->GetFName())++;
+	}
+
+	Component->DestroyComponent();
+	return true;
+}
+
+void ULyraClientOnlyComponentSubsystem::AuditCosmeticWork(UWorld* World)
+{
+	if (World == nullptr)
+	{
+		return;
+	}
+
+	TMap<FString, int32> ClientOnlyComponents;
+	TMap<FString, int32> ActiveEffectComponents;
+	TMap<FString, int32> ActiveAudioComponents;
+	TMap<FString, int32> FullyTickingMeshes;
+
+	for (TActorIterator<AActor> ActorIt(World); ActorIt; ++ActorIt)
+	{
+		TInlineComponentArray<UActorComponent*> Components(*ActorIt);
+		for (UActorComponent* Component : Components)
+		{
+			if (Component->IsBeingDestroyed())
+			{
+				continue;
+			}
+
+			const FString Key = FString::Printf(TEXT("%s on %s"), *Component->GetClass()->GetName(), *ActorIt->GetClass()->GetName());
+
+			if (ILyraClientOnlyComponentInterface::IsClientOnlyComponent(Component))
+			{
+				ClientOnlyComponents.FindOrAdd(Key)++;
+			}
+			else if (const UFXSystemComponent* EffectComponent = Cast<UFXSystemComponent>(Component))
+			{
+				if (EffectComponent->IsActive())
+				{
+					ActiveEffectComponents.FindOrAdd(Key)++;
+				}
+			}
+			else if (const UAudioComponent* AudioComponent = Cast<UAudioComponent>(Component))
+			{
+				if (AudioComponent->IsActive())
+				{
+					ActiveAudioComponents.FindOrAdd(Key)++;
+				}
+			}
+			else if (const USkeletalMeshComponent* MeshComponent = Cast<USkeletalMeshComponent>(Component))
+			{
+				// Nothing is rendered on a server, so anything ticking more than montages is running the full anim graph
+				const bool bTicksFullPose =
+					(MeshComponent->VisibilityBasedAnimTickOption == EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones) ||
+					(MeshComponent->VisibilityBasedAnimTickOption == EVisibilityBasedAnimTickOption::AlwaysTickPose);
+
+				if (bTicksFullPose && MeshComponent->IsComponentTickEnabled())
+				{
+					FullyTickingMeshes.FindOrAdd(Key)++;
+				}
+			}
+		}
+	}
+
+	auto LogCategory = [](const TCHAR* Category, TMap<FString, int32>& Counts)
+	{
+		Counts.ValueSort(TGreater<int32>());
+
+		int32 Total = 0;
+		for (const TPair<FString, int32>& Pair : Counts)
+		{
+			Total += Pair.Value;
+		}
+
+		UE_LOG(LogLyra, Log, TEXT("  %s: %d"), Category, Total);
+		for (const TPair<FString, int32>& Pair : Counts)
+		{
+			UE_LOG(LogLyra, Log, TEXT("    %4d x %s"), Pair.Value, *Pair.Key);
+		}
+	};
+
+	UE_LOG(LogLyra, Log, TEXT("Cosmetic work in %s (NetMode %d):"), *GetNameSafe(World), (int32)World->GetNetMode());
+	LogCategory(TEXT("Client-only components still alive"), ClientOnlyComponents);
+	LogCategory(TEXT("Active effect components"), ActiveEffectComponents);
+	LogCategory(TEXT("Active audio components"), ActiveAudioComponents);
+	LogCategory(TEXT("Skeletal meshes ticking the full pose"), FullyTickingMeshes);
+
+	if (const ULyraClientOnlyComponentSubsystem* Subsystem = World->GetSubsystem<ULyraClientOnlyComponentSubsystem>())
+	{
+		UE_LOG(LogLyra, Log, TEXT("  Stripped client-only components:"));
+		for (const TPair<FName, int32>& Pair : Subsystem->StrippedComponentCounts)
+		{
+			UE_LOG(LogLyra, Log, TEXT("    %4d x %s"), Pair.Value, *Pair.Key.ToString());
+		}
+	}
+}
@@ -0,0 +1,54 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+
+#include "LyraClientOnlyComponentSubsystem.generated.h"
+
+#define UE_API LYRAGAME_API
+
+class AActor;
+class UActorComponent;
+class UObject;
+class UWorld;
+struct FComponentRequestHandle;
+
+/**
+ * Strips client-only components (see ILyraClientOnlyComponentInterface) on dedicated servers, keeps track of them
+ * and audits the cosmetic work that is still running there.
+ *
+ * Stripping hooks into the game framework component manager, so it covers every modular actor: their components are
+ * checked when the actor is added as a receiver (in PreInitializeComponents) and again when it is ready for play.
+ */
+UCLASS(MinimalAPI)
+class ULyraClientOnlyComponentSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~USubsystem interface
+	UE_API virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	UE_API virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	UE_API virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	/**
+	 * Destroys a client-only component when running on a dedicated server, returns true if it was destroyed.
+	 * Only needed for components of actors that aren't game framework component receivers.
+	 */
+	static UE_API bool StripIfDedicatedServer(UActorComponent* Component);
+
+	/** Logs the cosmetic work that is still running in the world, meant to be run on a server */
+	static UE_API void AuditCosmeticWork(UWorld* World);
+
+private:
+	void HandleActorExtension(AActor* Actor, FName EventName);
+
+	TSharedPtr<FComponentRequestHandle> ExtensionHandlerHandle;
+
+	// Number of stripped components, by class name
+	TMap<FName, int32> StrippedComponentCounts;
+};
+
+#undef UE_API
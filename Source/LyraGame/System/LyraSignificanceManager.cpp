@@ -2,5 +2,170 @@
 
 #include "LyraSignificanceManager.h"
 
+#include "Character/LyraCharacter.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(LyraSignificanceManager)
 
+namespace LyraSignificance
+{
+	static bool bEnableSignificance = true;
+	static FAutoConsoleVariableRef CVarEnableSignificance(
+		TEXT("Lyra.Significance.Enable"),
+		bEnableSignificance,
+		TEXT("Should cosmetic work on characters and pickups be scaled back by their significance to the local players"),
+		ECVF_Default);
+
+	static const FName CharacterTag(TEXT("Lyra.Character"));
+	static const FName CosmeticActorTag(TEXT("Lyra.CosmeticActor"));
+
+	// Anything closer than this is fully significant, in view or not
+	static constexpr double NearDistance = 1500.0;
+
+	// Significance fades to zero at this distance
+	static constexpr double MaxDistance = 10000.0;
+
+	// Cosine of the half angle of the cone in front of a viewpoint that counts as in view
+	static constexpr double ViewConeCos = 0.5;
+
+	// Multiplier for actors that are out of view or weren't rendered recently
+	static constexpr float OutOfViewScale = 0.25f;
+
+	// Mesh tick interval by significance level
+	static constexpr float CharacterMeshTickIntervals[] = { 0.0f, 1.0f / 30.0f, 1.0f / 15.0f, 0.2f };
+}
+
+ULyraSignificanceManager::ULyraSignificanceManager()
+{
+	if (!HasAnyFlags(RF_ClassDefaultObject) && !IsRunningDedicatedServer())
+	{
+		PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &ThisClass::HandleWorldPostActorTick);
+	}
+}
+
+void ULyraSignificanceManager::BeginDestroy()
+{
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+
+	Super::BeginDestroy();
+}
+
+void ULyraSignificanceManager::RegisterCharacter(ALyraCharacter* Character)
+{
+	check(Character);
+	RegisterObject(Character, LyraSignificance::CharacterTag, &ThisClass::CalculateActorSignificance, EPostSignificanceType::Sequential, &ThisClass::ApplyCharacterSignificance);
+}
+
+void ULyraSignificanceManager::RegisterCosmeticActor(AActor* Actor)
+{
+	check(Actor);
+	RegisterObject(Actor, LyraSignificance::CosmeticActorTag, &ThisClass::CalculateActorSignificance);
+}
+
+ELyraSignificanceLevel ULyraSignificanceManager::GetSignificanceLevel(const UObject* Object) const
+{
+	float Significance = 1.0f;
+	if (LyraSignificance::bEnableSignificance && QuerySignificance(Object, Significance))
+	{
+		return SignificanceToLevel(Significance);
+	}
+
+	return ELyraSignificanceLevel::Highest;
+}
+
+ELyraSignificanceLevel ULyraSignificanceManager::GetActorSignificanceLevel(const AActor* Actor)
+{
+	const ULyraSignificanceManager* SignificanceManager = Actor ? USignificanceManager::Get<ULyraSignificanceManager>(Actor->GetWorld()) : nullptr;
+	return SignificanceManager ? SignificanceManager->GetSignificanceLevel(Actor) : ELyraSignificanceLevel::Highest;
+}
+
+ELyraSignificanceLevel ULyraSignificanceManager::SignificanceToLevel(float Significance)
+{
+	if (Significance >= 0.7f)
+	{
+		return ELyraSignificanceLevel::Highest;
+	}
+	else if (Significance >= 0.4f)
+	{
+		return ELyraSignificanceLevel::Medium;
+	}
+	else if (Significance >= 0.1f)
+	{
+		return ELyraSignificanceLevel::Low;
+	}
+
+	return ELyraSignificanceLevel::Lowest;
+}
+
+float ULyraSignificanceManager::CalculateActorSignificance(USignificanceManager::FManagedObjectInfo* ObjectInfo, const FTransform& Viewpoint)
+{
+	// Can run in parallel for several objects, so this only reads from the actor
+	const AActor* Actor = Cast<AActor>(ObjectInfo->GetObject());
+	if (Actor == nullptr)
+	{
+		return 0.0f;
+	}
+
+	const FVector ToActor = Actor->GetActorLocation() - Viewpoint.GetLocation();
+	const double Distance = ToActor.Size();
+	if (Distance <= LyraSignificance::NearDistance)
+	{
+		return 1.0f;
+	}
+
+	const bool bInViewCone = (FVector::DotProduct(ToActor / Distance, Viewpoint.GetRotation().GetForwardVector()) >= LyraSignificance::ViewConeCos);
+	const bool bInView = bInViewCone && Actor->WasRecentlyRendered(0.2f);
+
+	const float DistanceScore = 1.0f - static_cast<float>(FMath::Clamp(Distance / LyraSignificance::MaxDistance, 0.0, 1.0));
+	return bInView ? DistanceScore : (DistanceScore * LyraSignificance::OutOfViewScale);
+}
+
+void ULyraSignificanceManager::ApplyCharacterSignificance(USignificanceManager::FManagedObjectInfo* ObjectInfo, float OldSignificance, float Significance, bool bFinal)
+{
+	ALyraCharacter* Character = Cast<ALyraCharacter>(ObjectInfo->GetObject());
+	USkeletalMeshComponent* Mesh = Character ? Character->GetMesh() : nullptr;
+	if (Mesh == nullptr)
+	{
+		return;
+	}
+
+	// Our own characters always animate at full rate
+	const bool bFullRate = bFinal || !LyraSignificance::bEnableSignificance || Character->IsLocallyControlled();
+	const ELyraSignificanceLevel Level = bFullRate ? ELyraSignificanceLevel::Highest : SignificanceToLevel(Significance);
+
+	const float TickInterval = LyraSignificance::CharacterMeshTickIntervals[static_cast<uint8>(Level)];
+	if (Mesh->GetComponentTickInterval() != TickInterval)
+	{
+		Mesh->SetComponentTickInterval(TickInterval);
+	}
+}
+
+void ULyraSignificanceManager::HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if ((World != GetWorld()) || !World->IsGameWorld())
+	{
+		return;
+	}
+
+	TArray<FTransform, TInlineAllocator<4>> Viewpoints;
+	for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		const APlayerController* PC = Iterator->Get();
+		if (PC && PC->IsLocalController())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			Viewpoints.Emplace(ViewRotation, ViewLocation);
+		}
+	}
+
+	if (Viewpoints.Num() > 0)
+	{
+		Update(Viewpoints);
+	}
+}
@@ -2,15 +2,71 @@
 
 #pragma once
 
+#include "Engine/EngineBaseTypes.h"
 #include "SignificanceManager.h"
 
 #include "LyraSignificanceManager.generated.h"
 
+class AActor;
+class ALyraCharacter;
 class UObject;
+class UWorld;
 
+/** How much an object matters to the local players, cosmetic work is scaled back the lower it is */
+UENUM()
+enum class ELyraSignificanceLevel : uint8
+{
+	// Close to a local player, or in view at short range
+	Highest,
+
+	// In view at medium range
+	Medium,
+
+	// In view far away, or out of view but not far
+	Low,
+
+	// Out of view and far away, nobody is looking at it
+	Lowest
+};
+
+/**
+ * ULyraSignificanceManager
+ *
+ *	Scores registered actors by their distance and visibility to each local player's view, once per frame.
+ *	Characters have their mesh tick interval scaled by it, other cosmetic systems query the level to skip work.
+ *	Only exists on clients, there are no viewpoints to score against on a dedicated server.
+ */
 UCLASS()
 class ULyraSignificanceManager : public USignificanceManager
 {
 	GENERATED_BODY()
 
+public:
+	ULyraSignificanceManager();
+
+	//~UObject interface
+	virtual void BeginDestroy() override;
+	//~End of UObject interface
+
+	// Registers a character, its animation updates less often the less significant it is
+	void RegisterCharacter(ALyraCharacter* Character);
+
+	// Registers an actor whose owner only wants to query its significance level
+	void RegisterCosmeticActor(AActor* Actor);
+
+	// Returns the level of a registered object, Highest for objects that aren't registered
+	ELyraSignificanceLevel GetSignificanceLevel(const UObject* Object) const;
+
+	// Returns the level of the actor in its world, Highest if there is no significance manager (e.g., in editor previews)
+	static ELyraSignificanceLevel GetActorSignificanceLevel(const AActor* Actor);
+
+	static ELyraSignificanceLevel SignificanceToLevel(float Significance);
+
+private:
+	static float CalculateActorSignificance(USignificanceManager::FManagedObjectInfo* ObjectInfo, const FTransform& Viewpoint);
+	static void ApplyCharacterSignificance(USignificanceManager::FManagedObjectInfo* ObjectInfo, float OldSignificance, float Significance, bool bFinal);
+
+	void HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	FDelegateHandle PostActorTickHandle;
 };
@@ -122,6 +122,132 @@ bool FIndicatorProjection::Project(const UIndicatorDescriptor& IndicatorDescript
 	return false;
 }
 
+bool FIndicatorProjection::GetProjectionPoint(const UIndicatorDescriptor& IndicatorDescriptor, FVector& OutWorldPoint)
+{
+	USceneComponent* Component = IndicatorDescriptor.GetSceneComponent();
+	if (Component == nullptr)
+	{
+		return false;
+	}
+
+	const EActorCanvasProjectionMode ProjectionMode = IndicatorDescriptor.GetProjectionMode();
+	switch (ProjectionMode)
+	{
+		case EActorCanvasProjectionMode::ComponentPoint:
+		{
+			const FVector WorldLocation = IndicatorDescriptor.GetComponentSocketName() != NAME_None
+				? Component->GetSocketTransform(IndicatorDescriptor.GetComponentSocketName()).GetLocation()
+				: Component->GetComponentLocation();
+
+			OutWorldPoint = WorldLocation + IndicatorDescriptor.GetWorldPositionOffset();
+			return true;
+		}
+		case EActorCanvasProjectionMode::ActorBoundingBox:
+		case EActorCanvasProjectionMode::ComponentBoundingBox:
+		{
+			const FBox IndicatorBox = (ProjectionMode == EActorCanvasProjectionMode::ActorBoundingBox)
+				? Component->GetOwner()->GetComponentsBoundingBox()
+				: Component->Bounds.GetBox();
+
+			OutWorldPoint = IndicatorBox.GetCenter() + (IndicatorBox.GetSize() * (IndicatorDescriptor.GetBoundingBoxAnchor() - FVector(0.5)));
+			return true;
+		}
+		default:
+			return false;
+	}
+}
+
+void FIndicatorProjection::ProjectBatch(FIndicatorProjectionBatch& Batch, const FSceneViewProjectionData& InProjectionData, const FVector2f& ScreenSize)
+{
+	const int32 Count = Batch.Num();
+	Batch.ScreenX.SetNumUninitialized(Count, EAllowShrinking::No);
+	Batch.ScreenY.SetNumUninitialized(Count, EAllowShrinking::No);
+	Batch.Depth.SetNumUninitialized(Count, EAllowShrinking::No);
+	Batch.InFrontOfCamera.SetNumUninitialized(Count, EAllowShrinking::No);
+
+	if (Count == 0)
+	{
+		return;
+	}
+
+	// ULocalPlayer::GetPixelPoint recomputes this for every point
+	const FMatrix ViewProjection = InProjectionData.ComputeViewProjectionMatrix();
+	const double M00 = ViewProjection.M[0][0], M10 = ViewProjection.M[1][0], M20 = ViewProjection.M[2][0], M30 = ViewProjection.M[3][0];
+	const double M01 = ViewProjection.M[0][1], M11 = ViewProjection.M[1][1], M21 = ViewProjection.M[2][1], M31 = ViewProjection.M[3][1];
+	const double M03 = ViewProjection.M[0][3], M13 = ViewProjection.M[1][3], M23 = ViewProjection.M[2][3], M33 = ViewProjection.M[3][3];
+	const double OriginX = InProjectionData.ViewOrigin.X, OriginY = InProjectionData.ViewOrigin.Y, OriginZ = InProjectionData.ViewOrigin.Z;
+	const double HalfWidth = ScreenSize.X * 0.5;
+	const double HalfHeight = ScreenSize.Y * 0.5;
+
+	const double* RESTRICT WorldX = Batch.WorldX.GetData();
+	const double* RESTRICT WorldY = Batch.WorldY.GetData();
+	const double* RESTRICT WorldZ = Batch.WorldZ.GetData();
+	const double* RESTRICT OffsetX = Batch.OffsetX.GetData();
+	const double* RESTRICT OffsetY = Batch.OffsetY.GetData();
+	double* RESTRICT ScreenX = Batch.ScreenX.GetData();
+	double* RESTRICT ScreenY = Batch.ScreenY.GetData();
+	double* RESTRICT Depth = Batch.Depth.GetData();
+	bool* RESTRICT InFrontOfCamera = Batch.InFrontOfCamera.GetData();
+
+	// Branch free over contiguous arrays so the compiler can vectorize it
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const double X = WorldX[Index];
+		const double Y = WorldY[Index];
+		const double Z = WorldZ[Index];
+
+		const double ClipX = X * M00 + Y * M10 + Z * M20 + M30;
+		const double ClipY = X * M01 + Y * M11 + Z * M21 + M31;
+		const double ClipW = X * M03 + Y * M13 + Z * M23 + M33;
+
+		const bool bInFront = ClipW > 0.0;
+		const double InvW = 1.0 / FMath::Max(FMath::Abs(ClipW), UE_DOUBLE_SMALL_NUMBER);
+
+		ScreenX[Index] = (1.0 + ClipX * InvW) * HalfWidth + OffsetX[Index] * (bInFront ? 1.0 : -1.0);
+		ScreenY[Index] = (1.0 - ClipY * InvW) * HalfHeight + OffsetY[Index];
+
+		const double DX = X - OriginX;
+		const double DY = Y - OriginY;
+		const double DZ = Z - OriginZ;
+		Depth[Index] = FMath::Sqrt(DX * DX + DY * DY + DZ * DZ);
+		InFrontOfCamera[Index] = bInFront;
+	}
+
+	// Push on-screen points behind the camera off the edge, like Project() does
+	const FBox2f ScreenBox(FVector2f::Zero(), ScreenSize);
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const FVector2f ScreenSpacePosition(ScreenX[Index], ScreenY[Index]);
+		if (!InFrontOfCamera[Index] && ScreenBox.IsInside(ScreenSpacePosition))
+		{
+			const FVector2f CenterToPosition = (ScreenSpacePosition - (ScreenSize / 2)).GetSafeNormal();
+			const FVector2f ScreenPositionFromBehind = (ScreenSize / 2) + CenterToPosition * ScreenSize;
+			ScreenX[Index] = ScreenPositionFromBehind.X;
+			ScreenY[Index] = ScreenPositionFromBehind.Y;
+		}
+	}
+}
+
+void FIndicatorProjectionBatch::Reset()
+{
+	SlotIndices.Reset();
+	WorldX.Reset();
+	WorldY.Reset();
+	WorldZ.Reset();
+	OffsetX.Reset();
+	OffsetY.Reset();
+}
+
+void FIndicatorProjectionBatch::Add(int32 SlotIndex, const FVector& WorldPoint, const FVector2D& ScreenSpaceOffset)
+{
+	SlotIndices.Add(SlotIndex);
+	WorldX.Add(WorldPoint.X);
+	WorldY.Add(WorldPoint.Y);
+	WorldZ.Add(WorldPoint.Z);
+	OffsetX.Add(ScreenSpaceOffset.X);
+	OffsetY.Add(ScreenSpaceOffset.Y);
+}
+
 void UIndicatorDescriptor::SetIndicatorManagerComponent(ULyraIndicatorManagerComponent* InManager)
 {
 	// Make sure nobody has set this.
@@ -16,9 +16,44 @@ class UUserWidget;
 struct FFrame;
 struct FSceneViewProjectionData;
 
+/**
+ * World points of indicators that project a single point, laid out as a structure of arrays so the whole
+ * canvas can be projected with one view-projection matrix in a single tight loop.
+ */
+struct FIndicatorProjectionBatch
+{
+	void Reset();
+	void Add(int32 SlotIndex, const FVector& WorldPoint, const FVector2D& ScreenSpaceOffset);
+	int32 Num() const { return SlotIndices.Num(); }
+
+	TArray<int32> SlotIndices;
+
+	// Inputs
+	TArray<double> WorldX;
+	TArray<double> WorldY;
+	TArray<double> WorldZ;
+	TArray<double> OffsetX;
+	TArray<double> OffsetY;
+
+	// Outputs
+	TArray<double> ScreenX;
+	TArray<double> ScreenY;
+	TArray<double> Depth;
+	TArray<bool> InFrontOfCamera;
+};
+
 struct FIndicatorProjection
 {
 	bool Project(const UIndicatorDescriptor& IndicatorDescriptor, const FSceneViewProjectionData& InProjectionData, const FVector2f& ScreenSize, FVector& ScreenPositionWithDepth);
+
+	/**
+	 * Gets the single world point this indicator projects, if any.
+	 * Screen bounding box modes project a whole box and return false, they have to go through Project().
+	 */
+	static bool GetProjectionPoint(const UIndicatorDescriptor& IndicatorDescriptor, FVector& OutWorldPoint);
+
+	/** Projects every point of the batch, same results as Project() on each of them but computes the view-projection matrix once */
+	static void ProjectBatch(FIndicatorProjectionBatch& Batch, const FSceneViewProjectionData& InProjectionData, const FVector2f& ScreenSize);
 };
 
 UENUM(BlueprintType)
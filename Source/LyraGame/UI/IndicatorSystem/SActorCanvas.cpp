@@ -202,6 +202,8 @@ EActiveTimerReturnType SActorCanvas::UpdateCanvas(double InCurrentTime, float In
 
 			bool IndicatorsChanged = false;
 
+			ProjectionBatch.Reset();
+
 			for (int32 ChildIndex = 0; ChildIndex < CanvasChildren.Num(); ++ChildIndex)
 			{
 				SActorCanvas::FSlot& CurChild = CanvasChildren[ChildIndex];
@@ -235,35 +237,35 @@ EActiveTimerReturnType SActorCanvas::UpdateCanvas(double InCurrentTime, float In
 					IndicatorsChanged = true;
 				}
 
+				// Single point indicators are projected together below, screen bounding boxes still go one by one
+				FVector WorldPoint;
+				if (FIndicatorProjection::GetProjectionPoint(*Indicator, OUT WorldPoint))
+				{
+					ProjectionBatch.Add(ChildIndex, WorldPoint, Indicator->GetScreenSpaceOffset());
+					continue;
+				}
+
 				FVector ScreenPositionWithDepth;
 
 				FIndicatorProjection Projector;
 				const bool Success = Projector.Project(*Indicator, ProjectionData, PaintGeometry.Size, OUT ScreenPositionWithDepth);
 
-				if (!Success)
-				{
-					CurChild.SetHasValidScreenPosition(false);
-					CurChild.SetInFrontOfCamera(false);
-
-					IndicatorsChanged |= CurChild.bIsDirty();
-					CurChild.ClearDirtyFlag();
-					continue;
-				}
+				IndicatorsChanged |= ApplyProjection(CurChild, Success, ScreenPositionWithDepth);
+			}
 
-				CurChild.SetInFrontOfCamera(Success);
-				CurChild.SetHasValidScreenPosition(CurChild.GetInFrontOfCamera() || Indicator->GetClampToScreen());
+			FIndicatorProjection::ProjectBatch(ProjectionBatch, ProjectionData, PaintGeometry.Size);
 
-				if (CurChild.HasValidScreenPosition())
-				{
-					// Only dirty the screen position if we can actually show this indicator.
-					CurChild.SetScreenPosition(FVector2D(ScreenPositionWithDepth));
-					CurChild.SetDepth(ScreenPositionWithDepth.X);
-				}
+			for (int32 BatchIndex = 0; BatchIndex < ProjectionBatch.Num(); ++BatchIndex)
+			{
+				SActorCanvas::FSlot& CurChild = CanvasChildren[ProjectionBatch.SlotIndices[BatchIndex]];
+				const FVector ScreenPositionWithDepth(ProjectionBatch.ScreenX[BatchIndex], ProjectionBatch.ScreenY[BatchIndex], ProjectionBatch.Depth[BatchIndex]);
 
-				CurChild.SetPriority(Indicator->GetPriority());
+				IndicatorsChanged |= ApplyProjection(CurChild, true, ScreenPositionWithDepth);
+			}
 
-				IndicatorsChanged |= CurChild.bIsDirty();
-				CurChild.ClearDirtyFlag();
+			if (IndicatorsChanged || bSortedSlotsDirty)
+			{
+				SortSlots();
 			}
 
 			if (IndicatorsChanged)
@@ -292,6 +294,51 @@ EActiveTimerReturnType SActorCanvas::UpdateCanvas(double InCurrentTime, float In
 	}
 }
 
+bool SActorCanvas::ApplyProjection(FSlot& Slot, bool bSuccess, const FVector& ScreenPositionWithDepth)
+{
+	if (!bSuccess)
+	{
+		Slot.SetHasValidScreenPosition(false);
+		Slot.SetInFrontOfCamera(false);
+	}
+	else
+	{
+		const UIndicatorDescriptor* Indicator = Slot.Indicator;
+
+		Slot.SetInFrontOfCamera(bSuccess);
+		Slot.SetHasValidScreenPosition(Slot.GetInFrontOfCamera() || Indicator->GetClampToScreen());
+
+		if (Slot.HasValidScreenPosition())
+		{
+			// Only dirty the screen position if we can actually show this indicator.
+			Slot.SetScreenPosition(FVector2D(ScreenPositionWithDepth));
+			Slot.SetDepth(ScreenPositionWithDepth.Z);
+		}
+
+		Slot.SetPriority(Indicator->GetPriority());
+	}
+
+	const bool bChanged = Slot.bIsDirty();
+	Slot.ClearDirtyFlag();
+	return bChanged;
+}
+
+void SActorCanvas::SortSlots() const
+{
+	SortedSlots.Reset(CanvasChildren.Num());
+	for (int32 ChildIndex = 0; ChildIndex < CanvasChildren.Num(); ++ChildIndex)
+	{
+		SortedSlots.Add(&CanvasChildren[ChildIndex]);
+	}
+
+	SortedSlots.StableSort([](const SActorCanvas::FSlot& A, const SActorCanvas::FSlot& B)
+	{
+		return A.GetPriority() == B.GetPriority() ? A.GetDepth() > B.GetDepth() : A.GetPriority() < B.GetPriority();
+	});
+
+	bSortedSlotsDirty = false;
+}
+
 void SActorCanvas::SetShowAnyIndicators(bool bIndicators)
 {
 	if (bShowAnyIndicators != bIndicators)
@@ -321,18 +368,12 @@ void SActorCanvas::OnArrangeChildren(const FGeometry& AllottedGeometry, FArrange
 		const FIntPoint FixedPadding = FIntPoint(10.0f, 10.0f) + FIntPoint(ArrowWidgetSize.X, ArrowWidgetSize.Y);
 		const FVector Center = FVector(AllottedGeometry.Size * 0.5f, 0.0f);
 
-		// Sort the children
-		TArray<const SActorCanvas::FSlot*> SortedSlots;
-		for (int32 ChildIndex = 0; ChildIndex < CanvasChildren.Num(); ++ChildIndex)
+		// Sorted by UpdateCanvas, only redo it here if slots were added or removed since
+		if (bSortedSlotsDirty)
 		{
-			SortedSlots.Add(&CanvasChildren[ChildIndex]);
+			SortSlots();
 		}
 
-		SortedSlots.StableSort([](const SActorCanvas::FSlot& A, const SActorCanvas::FSlot& B)
-		{
-			return A.GetPriority() == B.GetPriority() ? A.GetDepth() > B.GetDepth() : A.GetPriority() < B.GetPriority();
-		});
-
 		// Go through all the sorted children
 		for (int32 ChildIndex = 0; ChildIndex < SortedSlots.Num(); ++ChildIndex)
 		{
@@ -631,6 +672,7 @@ SActorCanvas::FScopedWidgetSlotArguments SActorCanvas::AddActorSlot(UIndicatorDe
 		{
 			if (TSharedPtr<SActorCanvas> Canvas = WeakCanvas.Pin())
 			{
+				Canvas->bSortedSlotsDirty = true;
 				Canvas->UpdateActiveTimer();
 			}
 		}};
@@ -643,6 +685,7 @@ int32 SActorCanvas::RemoveActorSlot(const TSharedRef<SWidget>& SlotWidget)
 		if ( SlotWidget == CanvasChildren[SlotIdx].GetWidget() )
 		{
 			CanvasChildren.RemoveAt(SlotIdx);
+			bSortedSlotsDirty = true;
 
 			UpdateActiveTimer();
 
@@ -4,6 +4,7 @@
 
 #include "AsyncMixin.h"
 #include "Blueprint/UserWidgetPool.h"
+#include "UI/IndicatorSystem/IndicatorDescriptor.h"
 #include "Widgets/SPanel.h"
 
 class FActiveTimerHandle;
@@ -215,6 +216,12 @@ private:
 	void SetShowAnyIndicators(bool bIndicators);
 	EActiveTimerReturnType UpdateCanvas(double InCurrentTime, float InDeltaTime);
 
+	/** Applies a projection result to the slot, returns true if the slot changed */
+	static bool ApplyProjection(FSlot& Slot, bool bSuccess, const FVector& ScreenPositionWithDepth);
+
+	/** Rebuilds SortedSlots by priority then depth */
+	void SortSlots() const;
+
 	/** Helper function for calculating the offset */
 	void GetOffsetAndSize(const UIndicatorDescriptor* Indicator,
 		FVector2D& OutSize, 
@@ -236,6 +243,13 @@ private:
 	mutable TPanelChildren<FArrowSlot> ArrowChildren;
 	FCombinedChildren AllChildren;
 
+	/** Reused every update to project the point indicators in one pass */
+	FIndicatorProjectionBatch ProjectionBatch;
+
+	/** Draw order of CanvasChildren, kept by UpdateCanvas so arranging doesn't sort every time */
+	mutable TArray<const FSlot*> SortedSlots;
+	mutable bool bSortedSlotsDirty = true;
+
 	FUserWidgetPool IndicatorPool;
 
 	const FSlateBrush* ActorCanvasArrowBrush = nullptr;
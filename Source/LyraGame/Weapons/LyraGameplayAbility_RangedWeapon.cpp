@@ -8,6 +8,7 @@
 #include "NativeGameplayTags.h"
 #include "Weapons/LyraWeaponStateComponent.h"
 #include "AbilitySystemComponent.h"
+#include "AbilitySystem/LyraGameplayAbilityTargetData_Cartridge.h"
 #include "AbilitySystem/LyraGameplayAbilityTargetData_SingleTargetHit.h"
 #include "DrawDebugHelpers.h"
 
@@ -486,10 +487,14 @@ void ULyraGameplayAbility_RangedWeapon::OnTargetDataReadyCallback(const FGamepla
 		// Take ownership of the target data to make sure no callbacks into game code invalidate it out from under us
 		FGameplayAbilityTargetDataHandle LocalTargetDataHandle(MoveTemp(const_cast<FGameplayAbilityTargetDataHandle&>(InData)));
 
+		// Cartridges sent by clients arrive packed, everything past this point works on individual bullets
+		FLyraGameplayAbilityTargetData_Cartridge::ExpandCartridges(LocalTargetDataHandle);
+
 		const bool bShouldNotifyServer = CurrentActorInfo->IsLocallyControlled() && !CurrentActorInfo->IsNetAuthority();
 		if (bShouldNotifyServer)
 		{
-			MyAbilityComponent->CallServerSetReplicatedTargetData(CurrentSpecHandle, CurrentActivationInfo.GetActivationPredictionKey(), LocalTargetDataHandle, ApplicationTag, MyAbilityComponent->ScopedPredictionKey);
+			const FGameplayAbilityTargetDataHandle ServerTargetDataHandle = FLyraGameplayAbilityTargetData_Cartridge::MakeCompactHandle(LocalTargetDataHandle);
+			MyAbilityComponent->CallServerSetReplicatedTargetData(CurrentSpecHandle, CurrentActivationInfo.GetActivationPredictionKey(), ServerTargetDataHandle, ApplicationTag, MyAbilityComponent->ScopedPredictionKey);
 		}
 
 		const bool bIsTargetDataValid = true;
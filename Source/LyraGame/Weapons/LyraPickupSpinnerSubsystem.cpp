@@ -0,0 +1,68 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LyraPickupSpinnerSubsystem.h"
+
+#include "Components/StaticMeshComponent.h"
+#include "Engine/World.h"
+#include "System/LyraSignificanceManager.h"
+#include "Weapons/LyraWeaponSpawner.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(LyraPickupSpinnerSubsystem)
+
+bool ULyraPickupSpinnerSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void ULyraPickupSpinnerSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const ULyraSignificanceManager* SignificanceManager = USignificanceManager::Get<ULyraSignificanceManager>(GetWorld());
+
+	for (ALyraWeaponSpawner* Spawner : Spawners)
+	{
+		// Nobody is looking at it, no need to spin it
+		if (SignificanceManager && (SignificanceManager->GetSignificanceLevel(Spawner) == ELyraSignificanceLevel::Lowest))
+		{
+			continue;
+		}
+
+		UStaticMeshComponent* WeaponMesh = Spawner ? Spawner->WeaponMesh.Get() : nullptr;
+		if (WeaponMesh && WeaponMesh->IsVisible())
+		{
+			WeaponMesh->AddRelativeRotation(FRotator(0.0f, DeltaTime * Spawner->WeaponMeshRotationSpeed, 0.0f));
+		}
+	}
+}
+
+bool ULyraPickupSpinnerSubsystem::IsTickable() const
+{
+	return Spawners.Num() > 0 && Super::IsTickable();
+}
+
+TStatId ULyraPickupSpinnerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(ULyraPickupSpinnerSubsystem, STATGROUP_Tickables);
+}
+
+void ULyraPickupSpinnerSubsystem::RegisterSpawner(ALyraWeaponSpawner* Spawner)
+{
+	check(Spawner);
+	Spawners.AddUnique(Spawner);
+
+	if (ULyraSignificanceManager* SignificanceManager = USignificanceManager::Get<ULyraSignificanceManager>(GetWorld()))
+	{
+		SignificanceManager->RegisterCosmeticActor(Spawner);
+	}
+}
+
+void ULyraPickupSpinnerSubsystem::UnregisterSpawner(ALyraWeaponSpawner* Spawner)
+{
+	Spawners.RemoveSwap(Spawner);
+
+	if (ULyraSignificanceManager* SignificanceManager = USignificanceManager::Get<ULyraSignificanceManager>(GetWorld()))
+	{
+		SignificanceManager->UnregisterObject(Spawner);
+	}
+}
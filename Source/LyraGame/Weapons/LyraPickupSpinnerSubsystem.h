@@ -0,0 +1,42 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+
+#include "LyraPickupSpinnerSubsystem.generated.h"
+
+#define UE_API LYRAGAME_API
+
+class ALyraWeaponSpawner;
+class UObject;
+
+/**
+ * Spins the display meshes of every registered pickup in a single batched update.
+ * Purely cosmetic, so it never exists on dedicated servers and spawners don't need to tick.
+ */
+UCLASS(MinimalAPI)
+class ULyraPickupSpinnerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~USubsystem interface
+	UE_API virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	//~End of USubsystem interface
+
+	//~FTickableGameObject interface
+	UE_API virtual void Tick(float DeltaTime) override;
+	UE_API virtual bool IsTickable() const override;
+	UE_API virtual TStatId GetStatId() const override;
+	//~End of FTickableGameObject interface
+
+	UE_API void RegisterSpawner(ALyraWeaponSpawner* Spawner);
+	UE_API void UnregisterSpawner(ALyraWeaponSpawner* Spawner);
+
+private:
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ALyraWeaponSpawner>> Spawners;
+};
+
+#undef UE_API
@@ -12,6 +12,70 @@
 
 UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Lyra_Weapon_SteadyAimingCamera, "Lyra.Weapon.SteadyAimingCamera");
 
+//////////////////////////////////////////////////////////////////////
+// FLyraBakedCurve
+
+void FLyraBakedCurve::Bake(const FRichCurve& SourceCurve, int32 NumSamples)
+{
+	Source = &SourceCurve;
+	Samples.Reset();
+	bHasAnyData = SourceCurve.HasAnyData();
+	DefaultValue = SourceCurve.Eval(0.0f);
+
+	if (!bHasAnyData)
+	{
+		return;
+	}
+
+	SourceCurve.GetTimeRange(/*out*/ MinTime, /*out*/ MaxTime);
+	bClampBelow = (SourceCurve.PreInfinityExtrap == RCCE_Constant);
+	bClampAbove = (SourceCurve.PostInfinityExtrap == RCCE_Constant);
+
+	if (MaxTime <= MinTime)
+	{
+		// A single key (or several at the same time) is a constant
+		Samples.Add(SourceCurve.Eval(MinTime));
+		InvSampleSpacing = 0.0f;
+		return;
+	}
+
+	NumSamples = FMath::Max(NumSamples, 2);
+	Samples.SetNumUninitialized(NumSamples);
+	const float SampleSpacing = (MaxTime - MinTime) / (NumSamples - 1);
+	for (int32 Index = 0; Index < NumSamples; ++Index)
+	{
+		Samples[Index] = SourceCurve.Eval(MinTime + SampleSpacing * Index);
+	}
+	// Make sure the ends are exact
+	Samples[NumSamples - 1] = SourceCurve.Eval(MaxTime);
+	InvSampleSpacing = 1.0f / SampleSpacing;
+}
+
+float FLyraBakedCurve::Eval(float InTime) const
+{
+	if (Samples.Num() == 0)
+	{
+		return bHasAnyData ? Source->Eval(InTime) : DefaultValue;
+	}
+
+	if (InTime <= MinTime)
+	{
+		return (bClampBelow || InTime == MinTime) ? Samples[0] : Source->Eval(InTime);
+	}
+
+	if (InTime >= MaxTime)
+	{
+		return (bClampAbove || InTime == MaxTime) ? Samples.Last() : Source->Eval(InTime);
+	}
+
+	const float Position = (InTime - MinTime) * InvSampleSpacing;
+	const int32 Index = FMath::Min(FMath::FloorToInt32(Position), Samples.Num() - 2);
+	return FMath::Lerp(Samples[Index], Samples[Index + 1], Position - Index);
+}
+
+//////////////////////////////////////////////////////////////////////
+// ULyraRangedWeaponInstance
+
 ULyraRangedWeaponInstance::ULyraRangedWeaponInstance(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -19,10 +83,20 @@ ULyraRangedWeaponInstance::ULyraRangedWeaponInstance(const FObjectInitializer& O
 	HeatToCoolDownPerSecondCurve.EditorCurveData.AddKey(0.0f, 2.0f);
 }
 
+void ULyraRangedWeaponInstance::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	// Instances are created with NewObject and never see PostLoad, so bake here as well
+	BakeCurves();
+}
+
 void ULyraRangedWeaponInstance::PostLoad()
 {
 	Super::PostLoad();
 
+	BakeCurves();
+
 #if WITH_EDITOR
 	UpdateDebugVisualization();
 #endif
@@ -32,6 +106,7 @@ void ULyraRangedWeaponInstance::PostLoad()
 void ULyraRangedWeaponInstance::PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent)
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
+	BakeCurves();
 	UpdateDebugVisualization();
 }
 
@@ -50,13 +125,10 @@ void ULyraRangedWeaponInstance::OnEquipped()
 	Super::OnEquipped();
 
 	// Start heat in the middle
-	float MinHeatRange;
-	float MaxHeatRange;
-	ComputeHeatRange(/*out*/ MinHeatRange, /*out*/ MaxHeatRange);
-	CurrentHeat = (MinHeatRange + MaxHeatRange) * 0.5f;
+	CurrentHeat = (CachedMinHeat + CachedMaxHeat) * 0.5f;
 
 	// Derive spread
-	CurrentSpreadAngle = HeatToSpreadCurve.GetRichCurveConst()->Eval(CurrentHeat);
+	CurrentSpreadAngle = BakedHeatToSpread.Eval(CurrentHeat);
 
 	// Default the multipliers to 1x
 	CurrentSpreadAngleMultiplier = 1.0f;
@@ -85,6 +157,19 @@ void ULyraRangedWeaponInstance::Tick(float DeltaSeconds)
 #endif
 }
 
+void ULyraRangedWeaponInstance::BakeCurves()
+{
+	BakedHeatToSpread.Bake(*HeatToSpreadCurve.GetRichCurveConst());
+	BakedHeatToHeatPerShot.Bake(*HeatToHeatPerShotCurve.GetRichCurveConst());
+	BakedHeatToCoolDownPerSecond.Bake(*HeatToCoolDownPerSecondCurve.GetRichCurveConst());
+	BakedDistanceDamageFalloff.Bake(*DistanceDamageFalloff.GetRichCurveConst());
+
+	ComputeHeatRange(/*out*/ CachedMinHeat, /*out*/ CachedMaxHeat);
+	ComputeSpreadRange(/*out*/ CachedMinSpread, /*out*/ CachedMaxSpread);
+
+	PhysicalMaterialMultiplierCache.Reset();
+}
+
 void ULyraRangedWeaponInstance::ComputeHeatRange(float& MinHeat, float& MaxHeat)
 {
 	float Min1;
@@ -111,11 +196,11 @@ void ULyraRangedWeaponInstance::ComputeSpreadRange(float& MinSpread, float& MaxS
 void ULyraRangedWeaponInstance::AddSpread()
 {
 	// Sample the heat up curve
-	const float HeatPerShot = HeatToHeatPerShotCurve.GetRichCurveConst()->Eval(CurrentHeat);
+	const float HeatPerShot = BakedHeatToHeatPerShot.Eval(CurrentHeat);
 	CurrentHeat = ClampHeat(CurrentHeat + HeatPerShot);
 
 	// Map the heat to the spread angle
-	CurrentSpreadAngle = HeatToSpreadCurve.GetRichCurveConst()->Eval(CurrentHeat);
+	CurrentSpreadAngle = BakedHeatToSpread.Eval(CurrentHeat);
 
 #if WITH_EDITOR
 	UpdateDebugVisualization();
@@ -124,12 +209,21 @@ void ULyraRangedWeaponInstance::AddSpread()
 
 float ULyraRangedWeaponInstance::GetDistanceAttenuation(float Distance, const FGameplayTagContainer* SourceTags, const FGameplayTagContainer* TargetTags) const
 {
-	const FRichCurve* Curve = DistanceDamageFalloff.GetRichCurveConst();
-	return Curve->HasAnyData() ? Curve->Eval(Distance) : 1.0f;
+	return BakedDistanceDamageFalloff.HasAnyData() ? BakedDistanceDamageFalloff.Eval(Distance) : 1.0f;
 }
 
 float ULyraRangedWeaponInstance::GetPhysicalMaterialAttenuation(const UPhysicalMaterial* PhysicalMaterial, const FGameplayTagContainer* SourceTags, const FGameplayTagContainer* TargetTags) const
 {
+	if ((PhysicalMaterial == nullptr) || (MaterialDamageMultiplier.Num() == 0))
+	{
+		return 1.0f;
+	}
+
+	if (const float* pCachedMultiplier = PhysicalMaterialMultiplierCache.Find(PhysicalMaterial))
+	{
+		return *pCachedMultiplier;
+	}
+
 	float CombinedMultiplier = 1.0f;
 	if (const UPhysicalMaterialWithTags* PhysMatWithTags = Cast<const UPhysicalMaterialWithTags>(PhysicalMaterial))
 	{
@@ -142,6 +236,7 @@ float ULyraRangedWeaponInstance::GetPhysicalMaterialAttenuation(const UPhysicalM
 		}
 	}
 
+	PhysicalMaterialMultiplierCache.Add(PhysicalMaterial, CombinedMultiplier);
 	return CombinedMultiplier;
 }
 
@@ -151,16 +246,12 @@ bool ULyraRangedWeaponInstance::UpdateSpread(float DeltaSeconds)
 
 	if (TimeSinceFired > SpreadRecoveryCooldownDelay)
 	{
-		const float CooldownRate = HeatToCoolDownPerSecondCurve.GetRichCurveConst()->Eval(CurrentHeat);
+		const float CooldownRate = BakedHeatToCoolDownPerSecond.Eval(CurrentHeat);
 		CurrentHeat = ClampHeat(CurrentHeat - (CooldownRate * DeltaSeconds));
-		CurrentSpreadAngle = HeatToSpreadCurve.GetRichCurveConst()->Eval(CurrentHeat);
+		CurrentSpreadAngle = BakedHeatToSpread.Eval(CurrentHeat);
 	}
-	
-	float MinSpread;
-	float MaxSpread;
-	ComputeSpreadRange(/*out*/ MinSpread, /*out*/ MaxSpread);
 
-	return FMath::IsNearlyEqual(CurrentSpreadAngle, MinSpread, KINDA_SMALL_NUMBER);
+	return FMath::IsNearlyEqual(CurrentSpreadAngle, CachedMinSpread, KINDA_SMALL_NUMBER);
 }
 
 bool ULyraRangedWeaponInstance::UpdateMultipliers(float DeltaSeconds)
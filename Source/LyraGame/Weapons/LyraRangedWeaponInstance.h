@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Curves/CurveFloat.h"
+#include "UObject/ObjectKey.h"
 
 #include "LyraWeaponInstance.h"
 #include "AbilitySystem/LyraAbilitySourceInterface.h"
@@ -11,6 +12,36 @@
 
 class UPhysicalMaterial;
 
+/**
+ * FLyraBakedCurve
+ *
+ * Fixed-resolution lookup table sampled from a rich curve, evaluated with linear interpolation.
+ * Inputs outside the keyed range fall back to the source curve unless it extrapolates as a constant.
+ */
+struct FLyraBakedCurve
+{
+public:
+	void Bake(const FRichCurve& SourceCurve, int32 NumSamples = 128);
+
+	float Eval(float InTime) const;
+
+	bool HasAnyData() const
+	{
+		return bHasAnyData;
+	}
+
+private:
+	TArray<float> Samples;
+	const FRichCurve* Source = nullptr;
+	float MinTime = 0.0f;
+	float MaxTime = 0.0f;
+	float InvSampleSpacing = 0.0f;
+	float DefaultValue = 0.0f;
+	bool bHasAnyData = false;
+	bool bClampBelow = true;
+	bool bClampAbove = true;
+};
+
 /**
  * ULyraRangedWeaponInstance
  *
@@ -26,6 +57,8 @@ public:
 
 	virtual void PostLoad() override;
 
+	virtual void PostInitProperties() override;
+
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
 
@@ -214,6 +247,21 @@ private:
 	// The current crouching multiplier
 	float CrouchingMultiplier = 1.0f;
 
+	// Lookup tables baked from the curves above, see BakeCurves()
+	FLyraBakedCurve BakedHeatToSpread;
+	FLyraBakedCurve BakedHeatToHeatPerShot;
+	FLyraBakedCurve BakedHeatToCoolDownPerSecond;
+	FLyraBakedCurve BakedDistanceDamageFalloff;
+
+	// Ranges of the heat curves, cached when baking
+	float CachedMinHeat = 0.0f;
+	float CachedMaxHeat = 0.0f;
+	float CachedMinSpread = 0.0f;
+	float CachedMaxSpread = 0.0f;
+
+	// Combined MaterialDamageMultiplier for each physical material seen so far
+	mutable TMap<TObjectKey<UPhysicalMaterial>, float> PhysicalMaterialMultiplierCache;
+
 public:
 	void Tick(float DeltaSeconds);
 
@@ -230,16 +278,15 @@ public:
 	//~End of ILyraAbilitySourceInterface interface
 
 private:
+	// Samples the spread, heat and falloff curves into lookup tables, must be called whenever they change
+	void BakeCurves();
+
 	void ComputeSpreadRange(float& MinSpread, float& MaxSpread);
 	void ComputeHeatRange(float& MinHeat, float& MaxHeat);
 
 	inline float ClampHeat(float NewHeat)
 	{
-		float MinHeat;
-		float MaxHeat;
-		ComputeHeatRange(/*out*/ MinHeat, /*out*/ MaxHeat);
-
-		return FMath::Clamp(NewHeat, MinHeat, MaxHeat);
+		return FMath::Clamp(NewHeat, CachedMinHeat, CachedMaxHeat);
 	}
 
 	// Updates the spread and returns true if the spread is at minimum
@@ -8,6 +8,7 @@
 #include "Components/StaticMeshComponent.h"
 #include "Engine/World.h"
 #include "Equipment/LyraPickupDefinition.h"
+#include "GameFramework/GameStateBase.h"
 #include "GameFramework/Pawn.h"
 #include "Inventory/InventoryFragment_SetStats.h"
 #include "Kismet/GameplayStatics.h"
@@ -16,6 +17,7 @@
 #include "NiagaraFunctionLibrary.h"
 #include "NiagaraSystem.h"
 #include "TimerManager.h"
+#include "Weapons/LyraPickupSpinnerSubsystem.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(LyraWeaponSpawner)
 
@@ -27,8 +29,8 @@ struct FHitResult;
 // Sets default values
 ALyraWeaponSpawner::ALyraWeaponSpawner()
 {
- 	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = true;
+	// Cool down progress is derived from a replicated timestamp and the mesh is spun by ULyraPickupSpinnerSubsystem
+	PrimaryActorTick.bCanEverTick = false;
 
 	RootComponent = CollisionVolume = CreateDefaultSubobject<UCapsuleComponent>(TEXT("CollisionVolume"));
 	CollisionVolume->InitCapsuleSize(80.f, 80.f);
@@ -43,6 +45,8 @@ ALyraWeaponSpawner::ALyraWeaponSpawner()
 	WeaponMeshRotationSpeed = 40.0f;
 	CoolDownTime = 30.0f;
 	CheckExistingOverlapDelay = 0.25f;
+	CoolDownPercentage = 0.0f;
+	CoolDownStartTime = -1.0;
 	bIsWeaponAvailable = true;
 	bReplicates = true;
 }
@@ -63,6 +67,15 @@ void ALyraWeaponSpawner::BeginPlay()
 			UE_LOG(LogLyra, Error, TEXT("'%s' does not have a valid weapon definition! Make sure to set this data on the instance!"), *GetNameSafe(this));	
 		}
 	}
+
+	// Spinning the pickup is purely cosmetic
+	if (GetNetMode() != NM_DedicatedServer)
+	{
+		if (ULyraPickupSpinnerSubsystem* SpinnerSubsystem = UWorld::GetSubsystem<ULyraPickupSpinnerSubsystem>(GetWorld()))
+		{
+			SpinnerSubsystem->RegisterSpawner(this);
+		}
+	}
 }
 
 void ALyraWeaponSpawner::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -72,23 +85,13 @@ void ALyraWeaponSpawner::EndPlay(const EEndPlayReason::Type EndPlayReason)
 		World->GetTimerManager().ClearTimer(CoolDownTimerHandle);
 		World->GetTimerManager().ClearTimer(CheckOverlapsDelayTimerHandle);
 	}
-	
-	Super::EndPlay(EndPlayReason);
-}
-
-// Called every frame
-void ALyraWeaponSpawner::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
 
-	//Update the CoolDownPercentage property to drive respawn time indicators
-	UWorld* World = GetWorld();
-	if (World->GetTimerManager().IsTimerActive(CoolDownTimerHandle))
+	if (ULyraPickupSpinnerSubsystem* SpinnerSubsystem = UWorld::GetSubsystem<ULyraPickupSpinnerSubsystem>(GetWorld()))
 	{
-		CoolDownPercentage = 1.0f - World->GetTimerManager().GetTimerRemaining(CoolDownTimerHandle)/CoolDownTime;
+		SpinnerSubsystem->UnregisterSpawner(this);
 	}
-
-	WeaponMesh->AddRelativeRotation(FRotator(0.0f, World->GetDeltaSeconds() * WeaponMeshRotationSpeed, 0.0f));
+	
+	Super::EndPlay(EndPlayReason);
 }
 
 void ALyraWeaponSpawner::OnConstruction(const FTransform& Transform)
@@ -143,8 +146,16 @@ void ALyraWeaponSpawner::AttemptPickUpWeapon_Implementation(APawn* Pawn)
 
 void ALyraWeaponSpawner::StartCoolDown()
 {
+	// Clients only need the replicated start time to display progress, availability comes back through OnRep_WeaponAvailability
+	if (GetLocalRole() != ROLE_Authority)
+	{
+		return;
+	}
+
 	if (UWorld* World = GetWorld())
 	{
+		const AGameStateBase* GameState = World->GetGameState();
+		CoolDownStartTime = GameState ? GameState->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
 		World->GetTimerManager().SetTimer(CoolDownTimerHandle, this, &ALyraWeaponSpawner::OnCoolDownTimerComplete, CoolDownTime);
 	}
 }
@@ -170,7 +181,7 @@ void ALyraWeaponSpawner::ResetCoolDown()
 		}
 	}
 
-	CoolDownPercentage = 0.0f;
+	CoolDownStartTime = -1.0;
 }
 
 void ALyraWeaponSpawner::OnCoolDownTimerComplete()
@@ -178,6 +189,19 @@ void ALyraWeaponSpawner::OnCoolDownTimerComplete()
 	ResetCoolDown();
 }
 
+float ALyraWeaponSpawner::GetCoolDownPercentage() const
+{
+	const UWorld* World = GetWorld();
+	if (bIsWeaponAvailable || CoolDownStartTime < 0.0 || CoolDownTime <= 0.0f || World == nullptr)
+	{
+		return 0.0f;
+	}
+
+	const AGameStateBase* GameState = World->GetGameState();
+	const double Now = GameState ? GameState->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+	return FMath::Clamp(static_cast<float>((Now - CoolDownStartTime) / CoolDownTime), 0.0f, 1.0f);
+}
+
 void ALyraWeaponSpawner::SetWeaponPickupVisibility(bool bShouldBeVisible)
 {
 	WeaponMesh->SetVisibility(bShouldBeVisible, true);
@@ -239,6 +263,7 @@ void ALyraWeaponSpawner::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& O
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
 	DOREPLIFETIME(ALyraWeaponSpawner, bIsWeaponAvailable);
+	DOREPLIFETIME(ALyraWeaponSpawner, CoolDownStartTime);
 }
 
 int32 ALyraWeaponSpawner::GetDefaultStatFromItemDef(const TSubclassOf<ULyraInventoryItemDefinition> WeaponItemClass, FGameplayTag StatTag)
@@ -36,9 +36,6 @@ protected:
 	UE_API virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:	
-	// Called every frame
-	UE_API virtual void Tick(float DeltaTime) override;
-
 	UE_API void OnConstruction(const FTransform& Transform) override;
 
 protected:
@@ -57,10 +54,14 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Lyra|WeaponPickup")
 	float CheckExistingOverlapDelay;
 
-	//Used to drive weapon respawn time indicators 0-1
-	UPROPERTY(BlueprintReadOnly, Transient, Category = "Lyra|WeaponPickup")
+	//Used to drive weapon respawn time indicators 0-1, computed on read from CoolDownStartTime
+	UPROPERTY(BlueprintGetter = GetCoolDownPercentage, Transient, Category = "Lyra|WeaponPickup")
 	float CoolDownPercentage;
 
+	//Server world time at which the current cool down started, negative while the weapon is available
+	UPROPERTY(Replicated, Transient)
+	double CoolDownStartTime;
+
 public:
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Lyra|WeaponPickup")
@@ -99,6 +100,9 @@ public:
 	UFUNCTION()
 	UE_API void OnCoolDownTimerComplete();
 
+	UFUNCTION(BlueprintGetter)
+	UE_API float GetCoolDownPercentage() const;
+
 	UE_API void SetWeaponPickupVisibility(bool bShouldBeVisible);
 
 	UFUNCTION(BlueprintNativeEvent, Category = "Lyra|WeaponPickup")